@@ -106,12 +106,9 @@ void CommunicateMesh::receiveMesh(
     std::vector<int>    globalIDs;
     _communication->receive(vertexCoords, rankSender);
     _communication->receive(globalIDs, rankSender);
+    const Eigen::Map<const Eigen::MatrixXd> coords(vertexCoords.data(), dim, numberOfVertices);
     for (int i = 0; i < numberOfVertices; i++) {
-      Eigen::VectorXd coords(dim);
-      for (int d = 0; d < dim; d++) {
-        coords[d] = vertexCoords[i * dim + d];
-      }
-      mesh::Vertex &v = mesh.createVertex(coords);
+      mesh::Vertex &v = mesh.createVertex(coords.col(i));
       PRECICE_ASSERT(v.getID() >= 0, v.getID());
       v.setGlobalIndex(globalIDs[i]);
       vertices.push_back(&v);
@@ -125,6 +122,7 @@ void CommunicateMesh::receiveMesh(
   boost::container::flat_map<int, mesh::Vertex *> vertexMap;
   vertexMap.reserve(numberOfVertices);
   std::vector<mesh::Edge *> edges;
+  edges.reserve(numberOfEdges);
   if (numberOfEdges > 0) {
     std::vector<int> vertexIDs;
     _communication->receive(vertexIDs, rankSender);
@@ -253,12 +251,9 @@ void CommunicateMesh::broadcastReceiveMesh(
     std::vector<int>    globalIDs;
     _communication->broadcast(vertexCoords, rankBroadcaster);
     _communication->broadcast(globalIDs, rankBroadcaster);
+    const Eigen::Map<const Eigen::MatrixXd> coords(vertexCoords.data(), dim, numberOfVertices);
     for (int i = 0; i < numberOfVertices; i++) {
-      Eigen::VectorXd coords(dim);
-      for (int d = 0; d < dim; d++) {
-        coords[d] = vertexCoords[i * dim + d];
-      }
-      mesh::Vertex &v = mesh.createVertex(coords);
+      mesh::Vertex &v = mesh.createVertex(coords.col(i));
       PRECICE_ASSERT(v.getID() >= 0, v.getID());
       v.setGlobalIndex(globalIDs[i]);
       vertices.push_back(&v);
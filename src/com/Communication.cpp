@@ -4,6 +4,7 @@
 #include <ostream>
 #include "Request.hpp"
 #include "logging/LogMacros.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice {
 namespace com {
@@ -124,6 +125,40 @@ void Communication::allreduceSum(double const *itemsToSend, double *itemsToRecei
   receive(itemsToReceive, size, rankMaster + _rankOffset);
 }
 
+void Communication::allreduceSum(int const *itemsToSend, int *itemsToReceive, int size)
+{
+  PRECICE_TRACE(size);
+
+  std::copy(itemsToSend, itemsToSend + size, itemsToReceive);
+
+  std::vector<int> received(size);
+  // receive local results from slaves
+  for (size_t rank = 0; rank < getRemoteCommunicatorSize(); ++rank) {
+    receive(received.data(), size, rank + _rankOffset);
+    for (int i = 0; i < size; i++) {
+      itemsToReceive[i] += received[i];
+    }
+  }
+
+  // send reduced result to all slaves
+  std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
+  for (size_t rank = 0; rank < getRemoteCommunicatorSize(); ++rank) {
+    auto request   = aSend(itemsToReceive, size, rank + _rankOffset);
+    requests[rank] = request;
+  }
+  Request::wait(requests);
+}
+
+void Communication::allreduceSum(int const *itemsToSend, int *itemsToReceive, int size, int rankMaster)
+{
+  PRECICE_TRACE(size);
+
+  auto request = aSend(itemsToSend, size, rankMaster);
+  request->wait();
+  // receive reduced data from master
+  receive(itemsToReceive, size, rankMaster + _rankOffset);
+}
+
 void Communication::allreduceSum(double itemToSend, double &itemToReceive)
 {
   PRECICE_TRACE();
@@ -316,6 +351,27 @@ void Communication::broadcast(std::vector<double> &v, int rankBroadcaster)
   broadcast(v.data(), size, rankBroadcaster);
 }
 
+PtrPersistentRequest Communication::sendInit(const double *itemsToSend, int size, int rankReceiver)
+{
+  return nullptr;
+}
+
+PtrPersistentRequest Communication::receiveInit(double *itemsToReceive, int size, int rankSender)
+{
+  return nullptr;
+}
+
+PtrIndexedLayout Communication::createIndexedLayout(const std::vector<int> &indices, int valueDimension)
+{
+  return nullptr;
+}
+
+PtrRequest Communication::aReceiveIndexed(double *itemsToReceive, const IndexedLayout &layout, int rankSender)
+{
+  PRECICE_ASSERT(false, "Indexed communication is not supported by this communication.");
+  return nullptr;
+}
+
 int Communication::adjustRank(int rank) const
 {
   return rank - _rankOffset;
@@ -206,6 +206,9 @@ public:
   virtual void allreduceSum(double const *itemsToSend, double *itemsToReceive, int size, int rankMaster);
   virtual void allreduceSum(double const *itemsToSend, double *itemsToReceive, int size);
 
+  virtual void allreduceSum(int const *itemsToSend, int *itemsToReceive, int size, int rankMaster);
+  virtual void allreduceSum(int const *itemsToSend, int *itemsToReceive, int size);
+
   virtual void allreduceSum(double itemToSend, double &itemToReceive, int rankMaster);
   virtual void allreduceSum(double itemToSend, double &itemToReceive);
 
@@ -337,6 +340,46 @@ public:
 
   /// @}
 
+  /// @name Persistent communication
+  /// @{
+
+  /**
+   * @brief Creates a persistent request, which sends the array of double values on every start.
+   *
+   * @attention The caller must guarantee that the lifetime of the items extends to the destruction of the request!
+   * @return the request, or nullptr if persistent communication is not supported and aSend() has to be used
+   */
+  virtual PtrPersistentRequest sendInit(const double *itemsToSend, int size, int rankReceiver);
+
+  /**
+   * @brief Creates a persistent request, which receives the array of double values on every start.
+   *
+   * @attention The caller must guarantee that the lifetime of the items extends to the destruction of the request!
+   * @return the request, or nullptr if persistent communication is not supported and aReceive() has to be used
+   */
+  virtual PtrPersistentRequest receiveInit(double *itemsToReceive, int size, int rankSender);
+
+  /// @}
+
+  /// @name Indexed communication
+  /// @{
+
+  /**
+   * @brief Creates the layout of the values of the given vertices in an array of vertex values.
+   *
+   * @return the layout, or nullptr if indexed communication is not supported
+   */
+  virtual PtrIndexedLayout createIndexedLayout(const std::vector<int> &indices, int valueDimension);
+
+  /**
+   * @brief Asynchronously receives a contiguous message directly into the vertex values given by the layout.
+   *
+   * @pre The layout has been created by createIndexedLayout() of this communication.
+   */
+  virtual PtrRequest aReceiveIndexed(double *itemsToReceive, const IndexedLayout &layout, int rankSender);
+
+  /// @}
+
   /// Set rank offset.
   void setRankOffset(int rankOffset)
   {
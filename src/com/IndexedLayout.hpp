@@ -0,0 +1,17 @@
+#pragma once
+
+namespace precice {
+namespace com {
+
+/**
+ * @brief Layout of the values of a subset of vertices within an array of vertex values.
+ *
+ * Communications supporting layouts transfer such values directly from or to the array,
+ * without packing them into a contiguous buffer first.
+ */
+class IndexedLayout {
+public:
+  virtual ~IndexedLayout() = default;
+};
+} // namespace com
+} // namespace precice
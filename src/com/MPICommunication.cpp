@@ -3,6 +3,7 @@
 #include "MPICommunication.hpp"
 #include <ostream>
 #include <stddef.h>
+#include "MPIIndexedLayout.hpp"
 #include "MPIRequest.hpp"
 #include "logging/LogMacros.hpp"
 
@@ -405,6 +406,63 @@ void MPICommunication::receive(std::vector<double> &v, int rankSender)
            0, communicator(rankSender), MPI_STATUS_IGNORE);
 }
 
+PtrPersistentRequest MPICommunication::sendInit(const double *itemsToSend, int size, int rankReceiver)
+{
+  PRECICE_TRACE(size, rankReceiver);
+  rankReceiver = adjustRank(rankReceiver);
+
+  MPI_Request request;
+  MPI_Send_init(const_cast<double *>(itemsToSend),
+                size,
+                MPI_DOUBLE,
+                rank(rankReceiver),
+                0,
+                communicator(rankReceiver),
+                &request);
+
+  return std::make_shared<MPIPersistentRequest>(request);
+}
+
+PtrPersistentRequest MPICommunication::receiveInit(double *itemsToReceive, int size, int rankSender)
+{
+  PRECICE_TRACE(size, rankSender);
+  rankSender = adjustRank(rankSender);
+
+  MPI_Request request;
+  MPI_Recv_init(itemsToReceive,
+                size,
+                MPI_DOUBLE,
+                rank(rankSender),
+                0,
+                communicator(rankSender),
+                &request);
+
+  return std::make_shared<MPIPersistentRequest>(request);
+}
+
+PtrIndexedLayout MPICommunication::createIndexedLayout(const std::vector<int> &indices, int valueDimension)
+{
+  PRECICE_TRACE(indices.size(), valueDimension);
+  return std::make_shared<MPIIndexedLayout>(indices, valueDimension);
+}
+
+PtrRequest MPICommunication::aReceiveIndexed(double *itemsToReceive, const IndexedLayout &layout, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  rankSender = adjustRank(rankSender);
+
+  MPI_Request request;
+  MPI_Irecv(itemsToReceive,
+            1,
+            static_cast<const MPIIndexedLayout &>(layout).datatype(),
+            rank(rankSender),
+            0,
+            communicator(rankSender),
+            &request);
+
+  return PtrRequest(new MPIRequest(request));
+}
+
 } // namespace com
 } // namespace precice
 
@@ -133,6 +133,18 @@ public:
   void send(std::vector<double> const &v, int rankReceiver) override;
   void receive(std::vector<double> &v, int rankSender) override;
 
+  /// Creates a persistent request using MPI_Send_init()
+  PtrPersistentRequest sendInit(const double *itemsToSend, int size, int rankReceiver) override;
+
+  /// Creates a persistent request using MPI_Recv_init()
+  PtrPersistentRequest receiveInit(double *itemsToReceive, int size, int rankSender) override;
+
+  /// Creates the layout as MPI datatype
+  PtrIndexedLayout createIndexedLayout(const std::vector<int> &indices, int valueDimension) override;
+
+  /// Receives the message with the datatype of the layout
+  PtrRequest aReceiveIndexed(double *itemsToReceive, const IndexedLayout &layout, int rankSender) override;
+
 protected:
   /// Returns the communicator.
   virtual MPI_Comm &communicator(int rank) = 0;
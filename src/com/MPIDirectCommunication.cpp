@@ -112,6 +112,18 @@ void MPIDirectCommunication::allreduceSum(double const *itemsToSend, double *ite
   MPI_Allreduce(const_cast<double *>(itemsToSend), itemsToReceive, size, MPI_DOUBLE, MPI_SUM, _commState->comm);
 }
 
+void MPIDirectCommunication::allreduceSum(int const *itemsToSend, int *itemsToReceive, int size)
+{
+  PRECICE_TRACE(size);
+  MPI_Allreduce(const_cast<int *>(itemsToSend), itemsToReceive, size, MPI_INT, MPI_SUM, _commState->comm);
+}
+
+void MPIDirectCommunication::allreduceSum(int const *itemsToSend, int *itemsToReceive, int size, int rankMaster)
+{
+  PRECICE_TRACE(size);
+  MPI_Allreduce(const_cast<int *>(itemsToSend), itemsToReceive, size, MPI_INT, MPI_SUM, _commState->comm);
+}
+
 void MPIDirectCommunication::allreduceSum(double itemToSend, double &itemToReceive)
 {
   PRECICE_TRACE();
@@ -92,6 +92,10 @@ public:
 
   virtual void allreduceSum(double const *itemsToSend, double *itemsToReceive, int size) override;
 
+  virtual void allreduceSum(int const *itemsToSend, int *itemsToReceive, int size, int rankMaster) override;
+
+  virtual void allreduceSum(int const *itemsToSend, int *itemsToReceive, int size) override;
+
   virtual void allreduceSum(double itemToSend, double &itemsToReceive, int rankMaster) override;
 
   virtual void allreduceSum(double itemToSend, double &itemsToReceive) override;
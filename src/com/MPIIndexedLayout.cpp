@@ -0,0 +1,33 @@
+#ifndef PRECICE_NO_MPI
+
+#include "MPIIndexedLayout.hpp"
+
+namespace precice {
+namespace com {
+MPIIndexedLayout::MPIIndexedLayout(const std::vector<int> &indices, int valueDimension)
+{
+  // Displacements are given in multiples of the block, i.e. the values of one vertex
+  MPI_Datatype vertex;
+  MPI_Type_contiguous(valueDimension, MPI_DOUBLE, &vertex);
+  MPI_Type_create_indexed_block(static_cast<int>(indices.size()), 1, const_cast<int *>(indices.data()), vertex, &_datatype);
+  MPI_Type_commit(&_datatype);
+  MPI_Type_free(&vertex);
+}
+
+MPIIndexedLayout::~MPIIndexedLayout()
+{
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  if (not finalized) {
+    MPI_Type_free(&_datatype);
+  }
+}
+
+MPI_Datatype MPIIndexedLayout::datatype() const
+{
+  return _datatype;
+}
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_MPI
@@ -0,0 +1,30 @@
+#pragma once
+#ifndef PRECICE_NO_MPI
+
+#include <mpi.h>
+#include <vector>
+#include "IndexedLayout.hpp"
+
+namespace precice {
+namespace com {
+/// Indexed layout as committed MPI datatype of double values
+class MPIIndexedLayout : public IndexedLayout {
+public:
+  /// Creates and commits the datatype of the values of the vertices in indices
+  MPIIndexedLayout(const std::vector<int> &indices, int valueDimension);
+
+  /// Frees the datatype
+  ~MPIIndexedLayout() override;
+
+  MPIIndexedLayout(const MPIIndexedLayout &) = delete;
+  MPIIndexedLayout &operator=(const MPIIndexedLayout &) = delete;
+
+  MPI_Datatype datatype() const;
+
+private:
+  MPI_Datatype _datatype;
+};
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_MPI
@@ -22,6 +22,38 @@ void MPIRequest::wait()
 {
   MPI_Wait(&_request, MPI_STATUS_IGNORE);
 }
+
+MPIPersistentRequest::MPIPersistentRequest(MPI_Request request)
+    : _request(request)
+{
+}
+
+MPIPersistentRequest::~MPIPersistentRequest()
+{
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  if (not finalized) {
+    MPI_Request_free(&_request);
+  }
+}
+
+void MPIPersistentRequest::start()
+{
+  MPI_Start(&_request);
+}
+
+bool MPIPersistentRequest::test()
+{
+  // Inactive persistent requests complete immediately
+  int complete = 0;
+  MPI_Test(&_request, &complete, MPI_STATUS_IGNORE);
+  return complete;
+}
+
+void MPIPersistentRequest::wait()
+{
+  MPI_Wait(&_request, MPI_STATUS_IGNORE);
+}
 } // namespace com
 } // namespace precice
 
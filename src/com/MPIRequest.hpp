@@ -14,6 +14,27 @@ public:
 
   void wait() override;
 
+private:
+  MPI_Request _request;
+};
+
+/// Persistent MPI request, created by MPI_Send_init() or MPI_Recv_init()
+class MPIPersistentRequest : public PersistentRequest {
+public:
+  explicit MPIPersistentRequest(MPI_Request request);
+
+  /// Frees the request, which must not be active
+  ~MPIPersistentRequest() override;
+
+  MPIPersistentRequest(const MPIPersistentRequest &) = delete;
+  MPIPersistentRequest &operator=(const MPIPersistentRequest &) = delete;
+
+  void start() override;
+
+  bool test() override;
+
+  void wait() override;
+
 private:
   MPI_Request _request;
 };
@@ -16,5 +16,16 @@ public:
 
   virtual void wait() = 0;
 };
+
+/**
+ * @brief Request which is created once for a fixed buffer and started for every communication.
+ *
+ * Before start() is called, the request is completed. The buffer must outlive the request.
+ */
+class PersistentRequest : public Request {
+public:
+  /// Starts the communication of the buffer, the previous communication must be completed
+  virtual void start() = 0;
+};
 } // namespace com
 } // namespace precice
@@ -0,0 +1,896 @@
+#ifndef _WIN32
+
+#include "SharedMemoryCommunication.hpp"
+#include <algorithm>
+#include <atomic>
+#include <boost/asio.hpp>
+#include <boost/filesystem.hpp>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#include "ConnectionInfoPublisher.hpp"
+#include "Request.hpp"
+#include "logging/LogMacros.hpp"
+#include "utils/assertion.hpp"
+
+#ifdef __linux__
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
+namespace precice {
+namespace com {
+
+namespace asio = boost::asio;
+
+namespace {
+/// Marks a segment as initialized by the acceptor
+constexpr std::uint32_t segmentMagic = 0x70726563;
+
+/// Number of unsuccessful checks of a request before the waiting process goes to sleep
+constexpr int spinCount = 100;
+
+/// Maximal time to sleep before checking a request again, bounds the delay of missed wake ups
+constexpr long sleepNanoseconds = 1000000;
+
+/// Bounds of the polling interval of the background thread, while transfers are blocked by the peers
+constexpr std::chrono::microseconds minPollingInterval{50};
+constexpr std::chrono::microseconds maxPollingInterval{1000};
+
+/// Counters and wait flags of a single-producer single-consumer ring buffer in shared memory
+struct RingControl {
+  /// Bytes written in total, modulo 2^32
+  alignas(64) std::atomic<std::uint32_t> head{0};
+  /// Bytes read in total, modulo 2^32
+  alignas(64) std::atomic<std::uint32_t> tail{0};
+  alignas(64) std::atomic<std::uint32_t> readerWaiting{0};
+  std::atomic<std::uint32_t> writerWaiting{0};
+};
+
+/// Header at the beginning of every segment, followed by the data of both ring buffers
+struct SegmentHeader {
+  explicit SegmentHeader(std::uint32_t capacity)
+      : capacity(capacity)
+  {
+  }
+
+  std::atomic<std::uint32_t> magic{0};
+  std::uint32_t              capacity;
+  /// The acceptor writes to the first ring, the requester to the second one
+  RingControl rings[2];
+};
+
+constexpr std::size_t dataOffset()
+{
+  return (sizeof(SegmentHeader) + 63) / 64 * 64;
+}
+
+std::size_t segmentSize(std::size_t capacity)
+{
+  return dataOffset() + 2 * capacity;
+}
+
+/// Sleeps until the value of word differs from expected, a wake up is received or the timeout expired
+void futexWait(std::atomic<std::uint32_t> &word, std::uint32_t expected)
+{
+#ifdef __linux__
+  timespec timeout{0, sleepNanoseconds};
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+#else
+  std::this_thread::yield();
+#endif
+}
+
+/// Wakes up all processes sleeping on word
+void futexWake(std::atomic<std::uint32_t> &word)
+{
+#ifdef __linux__
+  syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+}
+
+/// Process-local view on a ring buffer in shared memory
+class Ring {
+public:
+  Ring(RingControl &control, char *data, std::uint32_t capacity)
+      : _control(control),
+        _data(data),
+        _capacity(capacity)
+  {
+  }
+
+  /// Writes as many bytes as fit into the buffer, returns the number of written bytes
+  std::size_t write(const char *items, std::size_t size)
+  {
+    const std::uint32_t head  = _control.head.load(std::memory_order_relaxed);
+    const std::uint32_t tail  = _control.tail.load(std::memory_order_acquire);
+    const std::size_t   count = std::min<std::size_t>(size, _capacity - (head - tail));
+    if (count == 0) {
+      return 0;
+    }
+    const std::size_t position = head & (_capacity - 1);
+    const std::size_t first    = std::min<std::size_t>(count, _capacity - position);
+    std::memcpy(_data + position, items, first);
+    std::memcpy(_data, items + first, count - first);
+    _control.head.store(head + static_cast<std::uint32_t>(count));
+    if (_control.readerWaiting.load()) {
+      futexWake(_control.head);
+    }
+    return count;
+  }
+
+  /// Reads as many bytes as available, returns the number of read bytes
+  std::size_t read(char *items, std::size_t size)
+  {
+    const std::uint32_t tail  = _control.tail.load(std::memory_order_relaxed);
+    const std::uint32_t head  = _control.head.load(std::memory_order_acquire);
+    const std::size_t   count = std::min<std::size_t>(size, head - tail);
+    if (count == 0) {
+      return 0;
+    }
+    const std::size_t position = tail & (_capacity - 1);
+    const std::size_t first    = std::min<std::size_t>(count, _capacity - position);
+    std::memcpy(items, _data + position, first);
+    std::memcpy(items + first, _data, count - first);
+    _control.tail.store(tail + static_cast<std::uint32_t>(count));
+    if (_control.writerWaiting.load()) {
+      futexWake(_control.tail);
+    }
+    return count;
+  }
+
+  /// Sleeps shortly, unless the buffer has free space
+  void waitForSpace()
+  {
+    const std::uint32_t tail = _control.tail.load();
+    _control.writerWaiting.store(1);
+    if (_control.head.load(std::memory_order_relaxed) - _control.tail.load() == _capacity) {
+      futexWait(_control.tail, tail);
+    }
+    _control.writerWaiting.store(0);
+  }
+
+  /// Sleeps shortly, unless the buffer contains data
+  void waitForData()
+  {
+    const std::uint32_t head = _control.head.load();
+    _control.readerWaiting.store(1);
+    if (_control.head.load() == _control.tail.load(std::memory_order_relaxed)) {
+      futexWait(_control.head, head);
+    }
+    _control.readerWaiting.store(0);
+  }
+
+private:
+  RingControl & _control;
+  char *const   _data;
+  std::uint32_t _capacity;
+};
+
+class SharedMemoryRequest;
+
+/// Bytes which remain to be sent or received by a request
+struct Transfer {
+  /// Points into the items of the sender, which are only read
+  char *      items;
+  std::size_t remaining;
+  /// The request refers to the connection holding this transfer, hence a weak pointer avoids a cycle
+  std::weak_ptr<SharedMemoryRequest> request;
+};
+} // namespace
+
+/// Mapped segment of a connection with the queues of pending transfers in both directions
+class SharedMemoryCommunication::Connection {
+public:
+  Connection(void *address, std::size_t size, bool isAcceptor)
+      : _address(address),
+        _size(size),
+        _header(*static_cast<SegmentHeader *>(address)),
+        _out(_header.rings[isAcceptor ? 0 : 1], static_cast<char *>(address) + dataOffset() + (isAcceptor ? 0 : _header.capacity), _header.capacity),
+        _in(_header.rings[isAcceptor ? 1 : 0], static_cast<char *>(address) + dataOffset() + (isAcceptor ? _header.capacity : 0), _header.capacity)
+  {
+  }
+
+  ~Connection()
+  {
+    munmap(_address, _size);
+  }
+
+  Connection(const Connection &) = delete;
+  Connection &operator=(const Connection &) = delete;
+
+  /// Queues a transfer, sends are queued if isSend and receives otherwise
+  void enqueue(bool isSend, Transfer transfer)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    (isSend ? _sends : _receives).push_back(std::move(transfer));
+  }
+
+  /// Transfers as much as possible without blocking, returns true if transfers are left
+  bool progress();
+
+  /// Sleeps shortly until the peer has read from or written to the connection
+  void waitForPeer(bool isSend)
+  {
+    if (isSend) {
+      _out.waitForSpace();
+    } else {
+      _in.waitForData();
+    }
+  }
+
+private:
+  void *const       _address;
+  const std::size_t _size;
+  SegmentHeader &   _header;
+  Ring              _out;
+  Ring              _in;
+
+  std::mutex           _mutex;
+  std::deque<Transfer> _sends;
+  std::deque<Transfer> _receives;
+};
+
+namespace {
+/**
+ * @brief Request of a transfer over a shared memory connection.
+ *
+ * Testing and waiting progresses the connection, hence requests complete even without the
+ * background thread of the communication.
+ */
+class SharedMemoryRequest : public Request {
+public:
+  SharedMemoryRequest(std::shared_ptr<SharedMemoryCommunication::Connection> connection, bool isSend)
+      : _connection(std::move(connection)),
+        _isSend(isSend)
+  {
+  }
+
+  void complete()
+  {
+    _complete.store(true, std::memory_order_release);
+  }
+
+  bool test() override
+  {
+    if (not _complete.load(std::memory_order_acquire)) {
+      _connection->progress();
+    }
+    return _complete.load(std::memory_order_acquire);
+  }
+
+  void wait() override
+  {
+    for (int spins = 0; not test(); ++spins) {
+      if (spins < spinCount) {
+        std::this_thread::yield();
+      } else {
+        _connection->waitForPeer(_isSend);
+      }
+    }
+  }
+
+private:
+  std::shared_ptr<SharedMemoryCommunication::Connection> _connection;
+
+  const bool _isSend;
+
+  std::atomic<bool> _complete{false};
+};
+
+/// Transfers the queued items of the front requests, returns true if transfers are left
+template <typename Function>
+bool progressQueue(std::deque<Transfer> &queue, Function transferBytes)
+{
+  while (not queue.empty()) {
+    auto &            transfer = queue.front();
+    const std::size_t count    = transferBytes(transfer.items, transfer.remaining);
+    transfer.items += count;
+    transfer.remaining -= count;
+    if (transfer.remaining > 0) {
+      return true;
+    }
+    if (auto request = transfer.request.lock()) {
+      request->complete();
+    }
+    queue.pop_front();
+  }
+  return false;
+}
+} // namespace
+
+bool SharedMemoryCommunication::Connection::progress()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  const bool                  sendsLeft    = progressQueue(_sends, [this](char *items, std::size_t size) { return _out.write(items, size); });
+  const bool                  receivesLeft = progressQueue(_receives, [this](char *items, std::size_t size) { return _in.read(items, size); });
+  return sendsLeft || receivesLeft;
+}
+
+SharedMemoryCommunication::SharedMemoryCommunication(std::string const &addressDirectory,
+                                                     std::size_t        bufferSize)
+    : _addressDirectory(addressDirectory),
+      _bufferSize(64)
+{
+  if (_addressDirectory.empty()) {
+    _addressDirectory = ".";
+  }
+  // The ring buffers compute positions by masking
+  while (_bufferSize < bufferSize) {
+    _bufferSize *= 2;
+  }
+  PRECICE_ASSERT(_bufferSize <= (std::size_t(1) << 31), _bufferSize);
+}
+
+SharedMemoryCommunication::~SharedMemoryCommunication()
+{
+  PRECICE_TRACE(_isConnected);
+  closeConnection();
+}
+
+size_t SharedMemoryCommunication::getRemoteCommunicatorSize()
+{
+  PRECICE_TRACE();
+  PRECICE_ASSERT(isConnected());
+  return _connections.size();
+}
+
+void SharedMemoryCommunication::acceptConnection(std::string const &acceptorName,
+                                                 std::string const &requesterName,
+                                                 std::string const &tag,
+                                                 int                acceptorRank,
+                                                 int                rankOffset)
+{
+  PRECICE_TRACE(acceptorName, requesterName);
+  PRECICE_ASSERT(not isConnected());
+
+  setRankOffset(rankOffset);
+
+  const std::string path = createSocketPath();
+  try {
+    using Protocol = asio::local::stream_protocol;
+    Protocol::acceptor   acceptor(_ioService, Protocol::endpoint(path));
+    ConnectionInfoWriter conInfo(acceptorName, requesterName, tag, _addressDirectory);
+    conInfo.write(path);
+    PRECICE_DEBUG("Accept connection at " << path);
+
+    int peerCurrent = 0;  // Current peer to connect to
+    int peerCount   = -1; // The total count of peers (initialized in the first iteration)
+
+    do {
+      Socket socket(_ioService);
+      acceptor.accept(socket);
+
+      int requesterRank             = -1;
+      int requesterCommunicatorSize = -1;
+      asio::read(socket, asio::buffer(&requesterRank, sizeof(int)));
+      asio::read(socket, asio::buffer(&requesterCommunicatorSize, sizeof(int)));
+      asio::write(socket, asio::buffer(&acceptorRank, sizeof(int)));
+      PRECICE_DEBUG("Accepted connection of rank " << requesterRank << " at " << path);
+
+      PRECICE_ASSERT(_connections.count(requesterRank) == 0,
+                     "Rank " << requesterRank << " has already been connected. Duplicate requests are not allowed.");
+      _connections[requesterRank] = createConnection(socket);
+
+      // Initialize the count of peers to connect to
+      if (peerCurrent == 0) {
+        peerCount = requesterCommunicatorSize;
+      }
+
+      PRECICE_ASSERT(requesterCommunicatorSize > 0,
+                     "Requester communicator size is " << requesterCommunicatorSize << " which is invalid.");
+      PRECICE_ASSERT(requesterCommunicatorSize == peerCount,
+                     "Current requester size from rank " << requesterRank << " is " << requesterCommunicatorSize << " but should be " << peerCount);
+    } while (++peerCurrent < peerCount);
+  } catch (std::exception &e) {
+    PRECICE_ERROR("Accepting a shared memory connection at " << path << " failed with the system error: " << e.what());
+  }
+  boost::filesystem::remove(path);
+
+  _isConnected = true;
+  startProgressThread();
+}
+
+void SharedMemoryCommunication::acceptConnectionAsServer(std::string const &acceptorName,
+                                                         std::string const &requesterName,
+                                                         std::string const &tag,
+                                                         int                acceptorRank,
+                                                         int                requesterCommunicatorSize)
+{
+  PRECICE_TRACE(acceptorName, requesterName, acceptorRank, requesterCommunicatorSize);
+  PRECICE_ASSERT(requesterCommunicatorSize >= 0, "Requester communicator size has to be positve.");
+  PRECICE_ASSERT(not isConnected());
+
+  if (requesterCommunicatorSize == 0) {
+    PRECICE_DEBUG("Accepting no connections.");
+    _isConnected = true;
+    return;
+  }
+
+  const std::string path = createSocketPath();
+  try {
+    using Protocol = asio::local::stream_protocol;
+    Protocol::acceptor   acceptor(_ioService, Protocol::endpoint(path));
+    ConnectionInfoWriter conInfo(acceptorName, requesterName, tag, acceptorRank, _addressDirectory);
+    conInfo.write(path);
+    PRECICE_DEBUG("Accepting connection at " << path);
+
+    for (int connection = 0; connection < requesterCommunicatorSize; ++connection) {
+      Socket socket(_ioService);
+      acceptor.accept(socket);
+
+      int requesterRank = -1;
+      asio::read(socket, asio::buffer(&requesterRank, sizeof(int)));
+      PRECICE_DEBUG("Accepted connection of rank " << requesterRank << " at " << path);
+      _connections[requesterRank] = createConnection(socket);
+    }
+  } catch (std::exception &e) {
+    PRECICE_ERROR("Accepting a shared memory connection at " << path << " failed with the system error: " << e.what());
+  }
+  boost::filesystem::remove(path);
+
+  _isConnected = true;
+  startProgressThread();
+}
+
+void SharedMemoryCommunication::requestConnection(std::string const &acceptorName,
+                                                  std::string const &requesterName,
+                                                  std::string const &tag,
+                                                  int                requesterRank,
+                                                  int                requesterCommunicatorSize)
+{
+  PRECICE_TRACE(acceptorName, requesterName);
+  PRECICE_ASSERT(not isConnected());
+
+  ConnectionInfoReader conInfo(acceptorName, requesterName, tag, _addressDirectory);
+  std::string const    path = conInfo.read();
+  PRECICE_DEBUG("Request connection to " << path);
+
+  try {
+    Socket socket(_ioService);
+    connect(socket, path, requesterRank);
+    asio::write(socket, asio::buffer(&requesterCommunicatorSize, sizeof(int)));
+    int acceptorRank = -1;
+    asio::read(socket, asio::buffer(&acceptorRank, sizeof(int)));
+    _connections[0] = openConnection(socket);
+  } catch (std::exception &e) {
+    PRECICE_ERROR("Requesting a shared memory connection at " << path << " failed with the system error: " << e.what());
+  }
+
+  _isConnected = true;
+  startProgressThread();
+}
+
+void SharedMemoryCommunication::requestConnectionAsClient(std::string const &  acceptorName,
+                                                          std::string const &  requesterName,
+                                                          std::string const &  tag,
+                                                          std::set<int> const &acceptorRanks,
+                                                          int                  requesterRank)
+
+{
+  PRECICE_TRACE(acceptorName, requesterName, acceptorRanks, requesterRank);
+  PRECICE_ASSERT(not isConnected());
+
+  for (auto const &acceptorRank : acceptorRanks) {
+    ConnectionInfoReader conInfo(acceptorName, requesterName, tag, acceptorRank, _addressDirectory);
+    std::string const    path = conInfo.read();
+    PRECICE_DEBUG("Requesting connection to " << path << ", rank = " << acceptorRank);
+
+    try {
+      Socket socket(_ioService);
+      connect(socket, path, requesterRank);
+      _connections[acceptorRank] = openConnection(socket);
+    } catch (std::exception &e) {
+      PRECICE_ERROR("Requesting a shared memory connection at " << path << " failed with the system error: " << e.what());
+    }
+  }
+
+  _isConnected = true;
+  startProgressThread();
+}
+
+void SharedMemoryCommunication::closeConnection()
+{
+  PRECICE_TRACE();
+
+  if (not isConnected())
+    return;
+
+  stopProgressThread();
+  // The segments stay mapped as long as requests refer to them
+  _connections.clear();
+  _isConnected = false;
+}
+
+void SharedMemoryCommunication::prepareEstablishment(std::string const &acceptorName,
+                                                     std::string const &requesterName)
+{
+  using namespace boost::filesystem;
+  path dir = com::impl::localDirectory(acceptorName, requesterName, _addressDirectory);
+  PRECICE_DEBUG("Creating connection exchange directory " << dir);
+  try {
+    create_directories(dir);
+  } catch (const boost::filesystem::filesystem_error &e) {
+    PRECICE_WARN("Creating directory for connection info failed with filesystem error: " << e.what());
+  }
+}
+
+void SharedMemoryCommunication::cleanupEstablishment(std::string const &acceptorName,
+                                                     std::string const &requesterName)
+{
+  using namespace boost::filesystem;
+  path dir = com::impl::localDirectory(acceptorName, requesterName, _addressDirectory);
+  PRECICE_DEBUG("Removing connection exchange directory " << dir);
+  try {
+    remove_all(dir);
+  } catch (const boost::filesystem::filesystem_error &e) {
+    PRECICE_WARN("Cleaning up connection info failed with filesystem error " << e.what());
+  }
+}
+
+std::shared_ptr<SharedMemoryCommunication::Connection> SharedMemoryCommunication::createConnection(Socket &socket)
+{
+  PRECICE_TRACE();
+  static std::atomic<int> segmentCount{0};
+  const std::string       name = "/precice-" + std::to_string(getpid()) + "-" + std::to_string(segmentCount++);
+  const std::size_t       size = segmentSize(_bufferSize);
+
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  PRECICE_CHECK(fd != -1, "Creating the shared memory segment \"" << name << "\" failed with the system error: " << std::strerror(errno));
+  if (ftruncate(fd, size) != 0) {
+    const int error = errno;
+    close(fd);
+    shm_unlink(name.c_str());
+    PRECICE_ERROR("Resizing the shared memory segment \"" << name << "\" failed with the system error: " << std::strerror(error));
+  }
+  void *address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (address == MAP_FAILED) {
+    const int error = errno;
+    shm_unlink(name.c_str());
+    PRECICE_ERROR("Mapping the shared memory segment \"" << name << "\" failed with the system error: " << std::strerror(error));
+  }
+  auto header = new (address) SegmentHeader(static_cast<std::uint32_t>(_bufferSize));
+  header->magic.store(segmentMagic);
+  auto connection = std::make_shared<Connection>(address, size, true);
+
+  // The name is removed as soon as the peer has mapped the segment, which then lives as long as it is mapped
+  const std::size_t length = name.size();
+  char              mapped = 0;
+  asio::write(socket, asio::buffer(&length, sizeof(std::size_t)));
+  asio::write(socket, asio::buffer(name));
+  asio::read(socket, asio::buffer(&mapped, sizeof(char)));
+  shm_unlink(name.c_str());
+  PRECICE_DEBUG("Created shared memory segment " << name << " of " << size << " bytes");
+  return connection;
+}
+
+std::shared_ptr<SharedMemoryCommunication::Connection> SharedMemoryCommunication::openConnection(Socket &socket)
+{
+  PRECICE_TRACE();
+  std::size_t length = 0;
+  asio::read(socket, asio::buffer(&length, sizeof(std::size_t)));
+  std::string name(length, '\0');
+  asio::read(socket, asio::buffer(&name[0], length));
+
+  int fd = shm_open(name.c_str(), O_RDWR, 0);
+  PRECICE_CHECK(fd != -1, "Opening the shared memory segment \"" << name << "\" failed with the system error: " << std::strerror(errno));
+  struct stat status;
+  fstat(fd, &status);
+  const std::size_t size    = status.st_size;
+  void *            address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  PRECICE_CHECK(address != MAP_FAILED, "Mapping the shared memory segment \"" << name << "\" failed with the system error: " << std::strerror(errno));
+  PRECICE_ASSERT(static_cast<SegmentHeader *>(address)->magic.load() == segmentMagic);
+  PRECICE_ASSERT(size == segmentSize(static_cast<SegmentHeader *>(address)->capacity), size);
+  auto connection = std::make_shared<Connection>(address, size, false);
+
+  const char mapped = 1;
+  asio::write(socket, asio::buffer(&mapped, sizeof(char)));
+  PRECICE_DEBUG("Opened shared memory segment " << name << " of " << size << " bytes");
+  return connection;
+}
+
+std::string SharedMemoryCommunication::createSocketPath() const
+{
+  // The length of socket paths is limited, hence the sockets are not created in the address directory
+  using namespace boost::filesystem;
+  return (temp_directory_path() / unique_path("precice-%%%%-%%%%-%%%%-%%%%.socket")).string();
+}
+
+void SharedMemoryCommunication::connect(Socket &socket, const std::string &path, int requesterRank)
+{
+  socket.connect(asio::local::stream_protocol::endpoint(path));
+  asio::write(socket, asio::buffer(&requesterRank, sizeof(int)));
+}
+
+void SharedMemoryCommunication::startProgressThread()
+{
+  _stopProgress   = false;
+  _progressThread = std::thread([this] { runProgress(); });
+}
+
+void SharedMemoryCommunication::stopProgressThread()
+{
+  if (not _progressThread.joinable()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(_progressMutex);
+    _stopProgress = true;
+  }
+  _progressCondition.notify_one();
+  _progressThread.join();
+}
+
+void SharedMemoryCommunication::runProgress()
+{
+  std::unique_lock<std::mutex> lock(_progressMutex);
+  auto                         pollingInterval = minPollingInterval;
+  while (not _stopProgress) {
+    _hasPendingWork = false;
+    lock.unlock();
+    bool transfersLeft = false;
+    for (auto &connection : _connections) {
+      transfersLeft |= connection.second->progress();
+    }
+    lock.lock();
+    if (transfersLeft) {
+      // Blocked by the peers, which do not signal this thread, hence poll with increasing intervals
+      _progressCondition.wait_for(lock, pollingInterval);
+      pollingInterval = std::min(2 * pollingInterval, maxPollingInterval);
+    } else {
+      _progressCondition.wait(lock, [this] { return _stopProgress || _hasPendingWork; });
+      pollingInterval = minPollingInterval;
+    }
+  }
+}
+
+const std::shared_ptr<SharedMemoryCommunication::Connection> &SharedMemoryCommunication::connection(int rank)
+{
+  PRECICE_ASSERT(rank >= 0, rank);
+  PRECICE_ASSERT(isConnected());
+  auto connection = _connections.find(rank);
+  PRECICE_ASSERT(connection != _connections.end(), rank);
+  return connection->second;
+}
+
+PtrRequest SharedMemoryCommunication::aSendBytes(const void *itemsToSend, std::size_t size, int rankReceiver)
+{
+  const auto &connection = this->connection(rankReceiver);
+  auto        request    = std::make_shared<SharedMemoryRequest>(connection, true);
+  connection->enqueue(true, {const_cast<char *>(static_cast<const char *>(itemsToSend)), size, request});
+  if (connection->progress()) {
+    {
+      std::lock_guard<std::mutex> lock(_progressMutex);
+      _hasPendingWork = true;
+    }
+    _progressCondition.notify_one();
+  }
+  return request;
+}
+
+PtrRequest SharedMemoryCommunication::aReceiveBytes(void *itemsToReceive, std::size_t size, int rankSender)
+{
+  const auto &connection = this->connection(rankSender);
+  auto        request    = std::make_shared<SharedMemoryRequest>(connection, false);
+  connection->enqueue(false, {static_cast<char *>(itemsToReceive), size, request});
+  if (connection->progress()) {
+    {
+      std::lock_guard<std::mutex> lock(_progressMutex);
+      _hasPendingWork = true;
+    }
+    _progressCondition.notify_one();
+  }
+  return request;
+}
+
+void SharedMemoryCommunication::send(std::string const &itemToSend, int rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  rankReceiver = adjustRank(rankReceiver);
+
+  std::size_t size = itemToSend.size() + 1;
+  aSendBytes(&size, sizeof(std::size_t), rankReceiver)->wait();
+  aSendBytes(itemToSend.c_str(), size, rankReceiver)->wait();
+}
+
+void SharedMemoryCommunication::send(const int *itemsToSend, int size, int rankReceiver)
+{
+  PRECICE_TRACE(size, rankReceiver);
+  aSend(itemsToSend, size, rankReceiver)->wait();
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const int *itemsToSend, int size, int rankReceiver)
+{
+  PRECICE_TRACE(size, rankReceiver);
+  rankReceiver = adjustRank(rankReceiver);
+  return aSendBytes(itemsToSend, size * sizeof(int), rankReceiver);
+}
+
+void SharedMemoryCommunication::send(const double *itemsToSend, int size, int rankReceiver)
+{
+  PRECICE_TRACE(size, rankReceiver);
+  aSend(itemsToSend, size, rankReceiver)->wait();
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const double *itemsToSend, int size, int rankReceiver)
+{
+  PRECICE_TRACE(size, rankReceiver);
+  rankReceiver = adjustRank(rankReceiver);
+  return aSendBytes(itemsToSend, size * sizeof(double), rankReceiver);
+}
+
+PtrRequest SharedMemoryCommunication::aSend(std::vector<double> const &itemsToSend, int rankReceiver)
+{
+  return aSend(itemsToSend.data(), itemsToSend.size(), rankReceiver);
+}
+
+void SharedMemoryCommunication::send(double itemToSend, int rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  aSend(&itemToSend, 1, rankReceiver)->wait();
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const double &itemToSend, int rankReceiver)
+{
+  return aSend(&itemToSend, 1, rankReceiver);
+}
+
+void SharedMemoryCommunication::send(int itemToSend, int rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  aSend(&itemToSend, 1, rankReceiver)->wait();
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const int &itemToSend, int rankReceiver)
+{
+  return aSend(&itemToSend, 1, rankReceiver);
+}
+
+void SharedMemoryCommunication::send(bool itemToSend, int rankReceiver)
+{
+  PRECICE_TRACE(itemToSend, rankReceiver);
+  aSend(itemToSend, rankReceiver)->wait();
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const bool &itemToSend, int rankReceiver)
+{
+  PRECICE_TRACE(rankReceiver);
+  rankReceiver = adjustRank(rankReceiver);
+  return aSendBytes(&itemToSend, sizeof(bool), rankReceiver);
+}
+
+void SharedMemoryCommunication::receive(std::string &itemToReceive, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  rankSender = adjustRank(rankSender);
+
+  std::size_t size = 0;
+  aReceiveBytes(&size, sizeof(std::size_t), rankSender)->wait();
+  std::vector<char> msg(size);
+  aReceiveBytes(msg.data(), size, rankSender)->wait();
+  itemToReceive = msg.data();
+}
+
+void SharedMemoryCommunication::receive(int *itemsToReceive, int size, int rankSender)
+{
+  PRECICE_TRACE(size, rankSender);
+  rankSender = adjustRank(rankSender);
+  aReceiveBytes(itemsToReceive, size * sizeof(int), rankSender)->wait();
+}
+
+void SharedMemoryCommunication::receive(double *itemsToReceive, int size, int rankSender)
+{
+  PRECICE_TRACE(size, rankSender);
+  aReceive(itemsToReceive, size, rankSender)->wait();
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(double *itemsToReceive,
+                                               int     size,
+                                               int     rankSender)
+{
+  PRECICE_TRACE(size, rankSender);
+  rankSender = adjustRank(rankSender);
+  return aReceiveBytes(itemsToReceive, size * sizeof(double), rankSender);
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(std::vector<double> &itemsToReceive, int rankSender)
+{
+  return aReceive(itemsToReceive.data(), itemsToReceive.size(), rankSender);
+}
+
+void SharedMemoryCommunication::receive(double &itemToReceive, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  aReceive(&itemToReceive, 1, rankSender)->wait();
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(double &itemToReceive, int rankSender)
+{
+  return aReceive(&itemToReceive, 1, rankSender);
+}
+
+void SharedMemoryCommunication::receive(int &itemToReceive, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  aReceive(itemToReceive, rankSender)->wait();
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(int &itemToReceive, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  rankSender = adjustRank(rankSender);
+  return aReceiveBytes(&itemToReceive, sizeof(int), rankSender);
+}
+
+void SharedMemoryCommunication::receive(bool &itemToReceive, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  aReceive(itemToReceive, rankSender)->wait();
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(bool &itemToReceive, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  rankSender = adjustRank(rankSender);
+  return aReceiveBytes(&itemToReceive, sizeof(bool), rankSender);
+}
+
+void SharedMemoryCommunication::send(std::vector<int> const &v, int rankReceiver)
+{
+  PRECICE_TRACE(rankReceiver);
+  rankReceiver = adjustRank(rankReceiver);
+
+  std::size_t size = v.size();
+  aSendBytes(&size, sizeof(std::size_t), rankReceiver)->wait();
+  aSendBytes(v.data(), size * sizeof(int), rankReceiver)->wait();
+}
+
+void SharedMemoryCommunication::receive(std::vector<int> &v, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  rankSender = adjustRank(rankSender);
+
+  std::size_t size = 0;
+  aReceiveBytes(&size, sizeof(std::size_t), rankSender)->wait();
+  v.resize(size);
+  aReceiveBytes(v.data(), size * sizeof(int), rankSender)->wait();
+}
+
+void SharedMemoryCommunication::send(std::vector<double> const &v, int rankReceiver)
+{
+  PRECICE_TRACE(rankReceiver);
+  rankReceiver = adjustRank(rankReceiver);
+
+  std::size_t size = v.size();
+  aSendBytes(&size, sizeof(std::size_t), rankReceiver)->wait();
+  aSendBytes(v.data(), size * sizeof(double), rankReceiver)->wait();
+}
+
+void SharedMemoryCommunication::receive(std::vector<double> &v, int rankSender)
+{
+  PRECICE_TRACE(rankSender);
+  rankSender = adjustRank(rankSender);
+
+  std::size_t size = 0;
+  aReceiveBytes(&size, sizeof(std::size_t), rankSender)->wait();
+  v.resize(size);
+  aReceiveBytes(v.data(), size * sizeof(double), rankSender)->wait();
+}
+
+} // namespace com
+} // namespace precice
+
+#endif // not _WIN32
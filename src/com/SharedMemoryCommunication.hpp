@@ -0,0 +1,212 @@
+#pragma once
+#ifndef _WIN32
+
+#include <boost/asio.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include "com/Communication.hpp"
+#include "com/SharedPointer.hpp"
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace com {
+/**
+ * @brief Implements Communication by using POSIX shared memory, for participants on the same node.
+ *
+ * Every connection is a shared memory segment with two ring buffers, one per direction. Waiting
+ * processes sleep on futexes in the segment and are woken up by their peer. The connections are
+ * established over Unix domain sockets, whose paths are exchanged in the address directory.
+ *
+ * Asynchronous communication is progressed by the waiting requests and by a background thread.
+ */
+class SharedMemoryCommunication : public Communication {
+public:
+  /// Default size of each ring buffer in bytes
+  static constexpr std::size_t defaultBufferSize = 1 << 20;
+
+  /**
+   * @param[in] addressDirectory Directory where the connection information is exchanged
+   * @param[in] bufferSize Size of the ring buffer per connection and direction in bytes, rounded up to a power of two
+   */
+  explicit SharedMemoryCommunication(std::string const &addressDirectory = ".",
+                                     std::size_t        bufferSize       = defaultBufferSize);
+
+  virtual ~SharedMemoryCommunication();
+
+  virtual size_t getRemoteCommunicatorSize() override;
+
+  virtual void acceptConnection(std::string const &acceptorName,
+                                std::string const &requesterName,
+                                std::string const &tag,
+                                int                acceptorRank,
+                                int                rankOffset = 0) override;
+
+  virtual void acceptConnectionAsServer(std::string const &acceptorName,
+                                        std::string const &requesterName,
+                                        std::string const &tag,
+                                        int                acceptorRank,
+                                        int                requesterCommunicatorSize) override;
+
+  virtual void requestConnection(std::string const &acceptorName,
+                                 std::string const &requesterName,
+                                 std::string const &tag,
+                                 int                requesterRank,
+                                 int                requesterCommunicatorSize) override;
+
+  virtual void requestConnectionAsClient(std::string const &  acceptorName,
+                                         std::string const &  requesterName,
+                                         std::string const &  tag,
+                                         std::set<int> const &acceptorRanks,
+                                         int                  requesterRank) override;
+
+  virtual void closeConnection() override;
+
+  /// Sends a std::string to process with given rank.
+  virtual void send(std::string const &itemToSend, int rankReceiver) override;
+
+  /// Sends an array of integer values.
+  virtual void send(const int *itemsToSend, int size, int rankReceiver) override;
+
+  /// Asynchronously sends an array of integer values.
+  virtual PtrRequest aSend(const int *itemsToSend, int size, int rankReceiver) override;
+
+  /// Sends an array of double values.
+  virtual void send(const double *itemsToSend, int size, int rankReceiver) override;
+
+  /// Asynchronously sends an array of double values.
+  virtual PtrRequest aSend(const double *itemsToSend, int size, int rankReceiver) override;
+
+  virtual PtrRequest aSend(std::vector<double> const &itemsToSend, int rankReceiver) override;
+
+  /// Sends a double to process with given rank.
+  virtual void send(double itemToSend, int rankReceiver) override;
+
+  /// Asynchronously sends a double to process with given rank.
+  virtual PtrRequest aSend(const double &itemToSend, int rankReceiver) override;
+
+  /// Sends an int to process with given rank.
+  virtual void send(int itemToSend, int rankReceiver) override;
+
+  /// Asynchronously sends an int to process with given rank.
+  virtual PtrRequest aSend(const int &itemToSend, int rankReceiver) override;
+
+  /// Sends a bool to process with given rank.
+  virtual void send(bool itemToSend, int rankReceiver) override;
+
+  /// Asynchronously sends a bool to process with given rank.
+  virtual PtrRequest aSend(const bool &itemToSend, int rankReceiver) override;
+
+  /// Receives a std::string from process with given rank.
+  virtual void receive(std::string &itemToReceive, int rankSender) override;
+
+  /// Receives an array of integer values.
+  virtual void receive(int *itemsToReceive, int size, int rankSender) override;
+
+  /// Receives an array of double values.
+  virtual void receive(double *itemsToReceive, int size, int rankSender) override;
+
+  /// Asynchronously receives an array of double values.
+  virtual PtrRequest aReceive(double *itemsToReceive,
+                              int     size,
+                              int     rankSender) override;
+
+  virtual PtrRequest aReceive(std::vector<double> &itemsToReceive, int rankSender) override;
+
+  /// Receives a double from process with given rank.
+  virtual void receive(double &itemToReceive, int rankSender) override;
+
+  /// Asynchronously receives a double from process with given rank.
+  virtual PtrRequest aReceive(double &itemToReceive, int rankSender) override;
+
+  /// Receives an int from process with given rank.
+  virtual void receive(int &itemToReceive, int rankSender) override;
+
+  /// Asynchronously receives an int from process with given rank.
+  virtual PtrRequest aReceive(int &itemToReceive, int rankSender) override;
+
+  /// Receives a bool from process with given rank.
+  virtual void receive(bool &itemToReceive, int rankSender) override;
+
+  /// Asynchronously receives a bool from process with given rank.
+  virtual PtrRequest aReceive(bool &itemToReceive, int rankSender) override;
+
+  void send(std::vector<int> const &v, int rankReceiver) override;
+  void receive(std::vector<int> &v, int rankSender) override;
+
+  void send(std::vector<double> const &v, int rankReceiver) override;
+  void receive(std::vector<double> &v, int rankSender) override;
+
+  virtual void prepareEstablishment(std::string const &acceptorName,
+                                    std::string const &requesterName) override;
+
+  virtual void cleanupEstablishment(std::string const &acceptorName,
+                                    std::string const &requesterName) override;
+
+  /// Connection to one remote rank, defined in the implementation
+  class Connection;
+
+private:
+  logging::Logger _log{"com::SharedMemoryCommunication"};
+
+  using IOService = boost::asio::io_service;
+  using Socket    = boost::asio::local::stream_protocol::socket;
+
+  /// Directory where the socket paths are exchanged by file.
+  std::string _addressDirectory;
+
+  /// Size of each ring buffer in bytes
+  std::size_t _bufferSize;
+
+  IOService _ioService;
+
+  /// Remote rank -> connection map
+  std::map<int, std::shared_ptr<Connection>> _connections;
+
+  /// @name Background progress of asynchronous communication
+  /// @{
+  std::thread             _progressThread;
+  std::mutex              _progressMutex;
+  std::condition_variable _progressCondition;
+  bool                    _hasPendingWork = false;
+  bool                    _stopProgress   = false;
+  /// @}
+
+  /// Creates a segment for the peer connected to the socket and hands it over
+  std::shared_ptr<Connection> createConnection(Socket &socket);
+
+  /// Maps the segment handed over by the peer connected to the socket
+  std::shared_ptr<Connection> openConnection(Socket &socket);
+
+  /// Returns a path for a Unix domain socket, which is unique on this node
+  std::string createSocketPath() const;
+
+  /// Connects to the acceptor listening at the socket path and announces the requester rank
+  void connect(Socket &socket, const std::string &path, int requesterRank);
+
+  void startProgressThread();
+
+  void stopProgressThread();
+
+  /// Progresses the connections with pending communication until stopped
+  void runProgress();
+
+  /// Queues the transfer of size bytes to the adjusted rank
+  PtrRequest aSendBytes(const void *itemsToSend, std::size_t size, int rankReceiver);
+
+  /// Queues the transfer of size bytes from the adjusted rank
+  PtrRequest aReceiveBytes(void *itemsToReceive, std::size_t size, int rankSender);
+
+  /// Returns the connection to the adjusted rank
+  const std::shared_ptr<Connection> &connection(int rank);
+};
+} // namespace com
+} // namespace precice
+
+#endif // not _WIN32
@@ -0,0 +1,33 @@
+#ifndef _WIN32
+
+#include "SharedMemoryCommunicationFactory.hpp"
+#include <memory>
+#include "SharedMemoryCommunication.hpp"
+#include "com/SharedPointer.hpp"
+
+namespace precice {
+namespace com {
+SharedMemoryCommunicationFactory::SharedMemoryCommunicationFactory(
+    std::string const &addressDirectory,
+    std::size_t        bufferSize)
+    : _addressDirectory(addressDirectory),
+      _bufferSize(bufferSize)
+{
+  if (_addressDirectory.empty()) {
+    _addressDirectory = ".";
+  }
+}
+
+PtrCommunication SharedMemoryCommunicationFactory::newCommunication()
+{
+  return std::make_shared<SharedMemoryCommunication>(_addressDirectory, _bufferSize);
+}
+
+std::string SharedMemoryCommunicationFactory::addressDirectory()
+{
+  return _addressDirectory;
+}
+} // namespace com
+} // namespace precice
+
+#endif // not _WIN32
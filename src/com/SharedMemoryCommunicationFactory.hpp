@@ -0,0 +1,28 @@
+#pragma once
+#ifndef _WIN32
+
+#include <cstddef>
+#include <string>
+#include "CommunicationFactory.hpp"
+#include "com/SharedMemoryCommunication.hpp"
+#include "com/SharedPointer.hpp"
+
+namespace precice {
+namespace com {
+class SharedMemoryCommunicationFactory : public CommunicationFactory {
+public:
+  explicit SharedMemoryCommunicationFactory(std::string const &addressDirectory = ".",
+                                            std::size_t        bufferSize       = SharedMemoryCommunication::defaultBufferSize);
+
+  PtrCommunication newCommunication() override;
+
+  std::string addressDirectory() override;
+
+private:
+  std::string _addressDirectory;
+  std::size_t _bufferSize;
+};
+} // namespace com
+} // namespace precice
+
+#endif // not _WIN32
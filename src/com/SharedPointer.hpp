@@ -7,10 +7,14 @@ namespace com {
 
 class Communication;
 class CommunicationFactory;
+class IndexedLayout;
+class PersistentRequest;
 class Request;
 
 using PtrCommunication        = std::shared_ptr<Communication>;
 using PtrCommunicationFactory = std::shared_ptr<CommunicationFactory>;
 using PtrRequest              = std::shared_ptr<Request>;
+using PtrPersistentRequest    = std::shared_ptr<PersistentRequest>;
+using PtrIndexedLayout        = std::shared_ptr<IndexedLayout>;
 } // namespace com
 } // namespace precice
@@ -1,5 +1,6 @@
 #include "SocketCommunication.hpp"
 #include <algorithm>
+#include <array>
 #include <boost/asio.hpp>
 #include <boost/bind.hpp>
 #include <boost/filesystem.hpp>
@@ -92,6 +93,7 @@ void SocketCommunication::acceptConnection(std::string const &acceptorName,
       auto socket = std::make_shared<Socket>(*_ioService);
 
       acceptor.accept(*socket);
+      socket->set_option(tcp::no_delay(true));
       PRECICE_DEBUG("Accepted connection at " << address);
       _isConnected = true;
 
@@ -177,6 +179,7 @@ void SocketCommunication::acceptConnectionAsServer(std::string const &acceptorNa
     for (int connection = 0; connection < requesterCommunicatorSize; ++connection) {
       auto socket = std::make_shared<Socket>(*_ioService);
       acceptor.accept(*socket);
+      socket->set_option(tcp::no_delay(true));
       PRECICE_DEBUG("Accepted connection at " << address);
       _isConnected = true;
 
@@ -236,6 +239,7 @@ void SocketCommunication::requestConnection(std::string const &acceptorName,
     }
 
     PRECICE_DEBUG("Requested connection to " << address);
+    socket->set_option(tcp::no_delay(true));
 
     asio::write(*socket, asio::buffer(&requesterRank, sizeof(int)));
 
@@ -299,6 +303,7 @@ void SocketCommunication::requestConnectionAsClient(std::string const &  accepto
       }
 
       PRECICE_DEBUG("Requested connection to " << address << ", rank = " << acceptorRank);
+      socket->set_option(tcp::no_delay(true));
       _sockets[acceptorRank] = socket;
       send(requesterRank, acceptorRank); // send my rank
 
@@ -349,8 +354,9 @@ void SocketCommunication::send(std::string const &itemToSend, int rankReceiver)
 
   size_t size = itemToSend.size() + 1;
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(&size, sizeof(size_t)));
-    asio::write(*_sockets[rankReceiver], asio::buffer(itemToSend.c_str(), size));
+    // Send the size and the string in a single gather write
+    const std::array<asio::const_buffer, 2> buffers{{asio::buffer(&size, sizeof(size_t)), asio::buffer(itemToSend.c_str(), size)}};
+    asio::write(*_sockets[rankReceiver], buffers);
   } catch (std::exception &e) {
     PRECICE_ERROR("Send using sockets failed with system error: " << e.what());
   }
@@ -764,8 +770,8 @@ void SocketCommunication::send(std::vector<int> const &v, int rankReceiver)
 
   size_t size = v.size();
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(&size, sizeof(size_t)));
-    asio::write(*_sockets[rankReceiver], asio::buffer(v));
+    const std::array<asio::const_buffer, 2> buffers{{asio::buffer(&size, sizeof(size_t)), asio::buffer(v)}};
+    asio::write(*_sockets[rankReceiver], buffers);
   } catch (std::exception &e) {
     PRECICE_ERROR("Send using sockets failed with system error: " << e.what());
   }
@@ -802,8 +808,8 @@ void SocketCommunication::send(std::vector<double> const &v, int rankReceiver)
 
   size_t size = v.size();
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(&size, sizeof(size_t)));
-    asio::write(*_sockets[rankReceiver], asio::buffer(v));
+    const std::array<asio::const_buffer, 2> buffers{{asio::buffer(&size, sizeof(size_t)), asio::buffer(v)}};
+    asio::write(*_sockets[rankReceiver], buffers);
   } catch (std::exception &e) {
     PRECICE_ERROR("Send using sockets failed with system error: " << e.what());
   }
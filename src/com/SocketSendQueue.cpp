@@ -3,6 +3,7 @@
 #include <iosfwd>
 #include <new>
 #include <utility>
+#include <vector>
 
 #include "SocketSendQueue.hpp"
 #include "logging/LogMacros.hpp"
@@ -23,7 +24,10 @@ void SocketSendQueue::dispatch(std::shared_ptr<Socket>      sock,
                                boost::asio::const_buffers_1 data,
                                std::function<void()>        callback)
 {
-  _itemQueue.push_back({std::move(sock), std::move(data), callback});
+  {
+    std::lock_guard<std::mutex> lock(_sendMutex);
+    _itemQueue.push_back({std::move(sock), std::move(data), std::move(callback)});
+  }
   process(); // if queue was previously empty, start it now.
 }
 
@@ -32,14 +36,33 @@ void SocketSendQueue::process()
   std::lock_guard<std::mutex> lock(_sendMutex);
   if (!_ready || _itemQueue.empty())
     return;
-  auto item = _itemQueue.front();
-  _itemQueue.pop_front();
+
+  // Coalesce all queued items for the socket of the first item into a single gather write.
+  // Their order is preserved, items for other sockets stay queued.
+  auto const                      sock = _itemQueue.front().sock;
+  std::vector<SendItem>           items;
+  std::vector<asio::const_buffer> buffers;
+  std::deque<SendItem>            remaining;
+  for (auto &item : _itemQueue) {
+    if (item.sock == sock) {
+      buffers.push_back(item.data);
+      items.push_back(std::move(item));
+    } else {
+      remaining.push_back(std::move(item));
+    }
+  }
+  _itemQueue.swap(remaining);
   _ready = false;
-  asio::async_write(*(item.sock),
-                    item.data,
-                    [item, this](boost::system::error_code const &, std::size_t) {
-                      item.callback();
-                      this->_ready = true;
+  asio::async_write(*sock,
+                    buffers,
+                    [items = std::move(items), this](boost::system::error_code const &, std::size_t) {
+                      for (auto const &item : items) {
+                        item.callback();
+                      }
+                      {
+                        std::lock_guard<std::mutex> lock(this->_sendMutex);
+                        this->_ready = true;
+                      }
                       this->process();
                     });
 }
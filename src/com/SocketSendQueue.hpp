@@ -13,6 +13,7 @@ namespace com {
 
 /// This Queue is intended for SocketCommunication to push requests which should be sent onto it.
 /// It ensures that the invocations of asio::aSend are done serially.
+/// All items queued for the same socket are sent together in a single gather write.
 class SocketSendQueue {
 public:
   using Socket = boost::asio::ip::tcp::socket;
@@ -27,7 +28,7 @@ public:
   void dispatch(std::shared_ptr<Socket> sock, boost::asio::const_buffers_1 data, std::function<void()> callback);
 
 private:
-  /// This method can be called arbitrarily many times, but enough times to ensure the queue makes progress.
+  /// Sends the queued items of the next socket. It can be called arbitrarily many times, but enough times to ensure the queue makes progress.
   void process();
 
   struct SendItem {
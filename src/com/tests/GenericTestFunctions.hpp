@@ -374,6 +374,17 @@ void TestReduceVectors(TestContext const &context)
       BOOST_CHECK_EQUAL_COLLECTIONS(rcv.begin(), rcv.end(),
                                     rcv_expected.begin(), rcv_expected.end());
     }
+    {
+      std::vector<int> msg{1, 2, 3};
+      std::vector<int> rcv{0, 0, 0};
+      com.allreduceSum(msg.data(), rcv.data(), msg.size());
+      std::vector<int> msg_expected{1, 2, 3};
+      BOOST_CHECK_EQUAL_COLLECTIONS(msg.begin(), msg.end(),
+                                    msg_expected.begin(), msg_expected.end());
+      std::vector<int> rcv_expected{11, 22, 33};
+      BOOST_CHECK_EQUAL_COLLECTIONS(rcv.begin(), rcv.end(),
+                                    rcv_expected.begin(), rcv_expected.end());
+    }
     com.closeConnection();
   } else {
     com.requestConnection("process0", "process1", "", 0, 1);
@@ -399,6 +410,17 @@ void TestReduceVectors(TestContext const &context)
       BOOST_CHECK_EQUAL_COLLECTIONS(rcv.begin(), rcv.end(),
                                     rcv_expected.begin(), rcv_expected.end());
     }
+    {
+      std::vector<int> msg{10, 20, 30};
+      std::vector<int> rcv{0, 0, 0};
+      com.allreduceSum(msg.data(), rcv.data(), msg.size(), 0);
+      std::vector<int> msg_expected{10, 20, 30};
+      BOOST_CHECK_EQUAL_COLLECTIONS(msg.begin(), msg.end(),
+                                    msg_expected.begin(), msg_expected.end());
+      std::vector<int> rcv_expected{11, 22, 33};
+      BOOST_CHECK_EQUAL_COLLECTIONS(rcv.begin(), rcv.end(),
+                                    rcv_expected.begin(), rcv_expected.end());
+    }
     com.closeConnection();
   }
 }
@@ -731,6 +753,17 @@ void TestReduceVectors(TestContext const &context)
       BOOST_CHECK_EQUAL_COLLECTIONS(rcv.begin(), rcv.end(),
                                     rcv_expected.begin(), rcv_expected.end());
     }
+    {
+      std::vector<int> msg{1, 2, 3};
+      std::vector<int> rcv{0, 0, 0};
+      com.allreduceSum(msg.data(), rcv.data(), msg.size());
+      std::vector<int> msg_expected{1, 2, 3};
+      BOOST_CHECK_EQUAL_COLLECTIONS(msg.begin(), msg.end(),
+                                    msg_expected.begin(), msg_expected.end());
+      std::vector<int> rcv_expected{11, 22, 33};
+      BOOST_CHECK_EQUAL_COLLECTIONS(rcv.begin(), rcv.end(),
+                                    rcv_expected.begin(), rcv_expected.end());
+    }
     com.closeConnection();
   } else {
     com.requestConnection("Master", "Slave", "", 0, 1);
@@ -756,6 +789,17 @@ void TestReduceVectors(TestContext const &context)
       BOOST_CHECK_EQUAL_COLLECTIONS(rcv.begin(), rcv.end(),
                                     rcv_expected.begin(), rcv_expected.end());
     }
+    {
+      std::vector<int> msg{10, 20, 30};
+      std::vector<int> rcv{0, 0, 0};
+      com.allreduceSum(msg.data(), rcv.data(), msg.size(), 0);
+      std::vector<int> msg_expected{10, 20, 30};
+      BOOST_CHECK_EQUAL_COLLECTIONS(msg.begin(), msg.end(),
+                                    msg_expected.begin(), msg_expected.end());
+      std::vector<int> rcv_expected{11, 22, 33};
+      BOOST_CHECK_EQUAL_COLLECTIONS(rcv.begin(), rcv.end(),
+                                    rcv_expected.begin(), rcv_expected.end());
+    }
     com.closeConnection();
   }
 }
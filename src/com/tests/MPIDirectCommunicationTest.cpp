@@ -1,7 +1,10 @@
 #ifndef PRECICE_NO_MPI
 
+#include <vector>
 #include "GenericTestFunctions.hpp"
+#include "com/IndexedLayout.hpp"
 #include "com/MPIDirectCommunication.hpp"
+#include "com/Request.hpp"
 #include "com/SharedPointer.hpp"
 #include "math/constants.hpp"
 #include "testing/TestContext.hpp"
@@ -20,6 +23,28 @@ BOOST_AUTO_TEST_CASE(SendAndReceive)
   testing::com::masterslave::TestSendAndReceive<MPIDirectCommunication>(context);
 }
 
+BOOST_AUTO_TEST_CASE(ReceiveIndexed)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  MPIDirectCommunication com;
+
+  if (context.isMaster()) {
+    com.acceptConnection("Master", "Slave", "", 0, 1);
+    // Values of vertices 3, 0 and 2 with two components each
+    std::vector<double> values(8, -1.0);
+    PtrIndexedLayout    layout = com.createIndexedLayout({3, 0, 2}, 2);
+    BOOST_TEST(layout);
+    com.aReceiveIndexed(values.data(), *layout, 1)->wait();
+    BOOST_TEST(values == std::vector<double>({3.0, 4.0, -1.0, -1.0, 5.0, 6.0, 1.0, 2.0}), boost::test_tools::per_element());
+    com.closeConnection();
+  } else {
+    com.requestConnection("Master", "Slave", "", 0, 1);
+    std::vector<double> msg{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    com.send(msg.data(), msg.size(), 0);
+    com.closeConnection();
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // MPIDirectCommunication
 
 BOOST_AUTO_TEST_SUITE_END() // Communication
@@ -0,0 +1,114 @@
+#include <string>
+#include <vector>
+#include "GenericTestFunctions.hpp"
+#include "com/SharedMemoryCommunication.hpp"
+#include "com/SharedPointer.hpp"
+#include "math/constants.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::com;
+
+BOOST_TEST_SPECIALIZED_COLLECTION_COMPARE(std::vector<int>)
+
+BOOST_AUTO_TEST_SUITE(CommunicationTests)
+
+BOOST_AUTO_TEST_SUITE(SharedMemory)
+
+BOOST_AUTO_TEST_CASE(SendAndReceiveMM)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  using namespace precice::testing::com::mastermaster;
+  TestSendAndReceive<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendAndReceiveMS)
+{
+  PRECICE_TEST(2_ranks, Require::Events);
+  using namespace precice::testing::com::masterslave;
+  TestSendAndReceive<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcesses)
+{
+  PRECICE_TEST("A"_on(2_ranks), "B"_on(2_ranks), Require::Events);
+  using namespace precice::testing::com::mastermaster;
+  TestSendReceiveFourProcesses<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveTwoProcessesServerClient)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  using namespace precice::testing::com::serverclient;
+  TestSendReceiveTwoProcessesServerClient<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClient)
+{
+  PRECICE_TEST("A"_on(2_ranks), "B"_on(2_ranks), Require::Events);
+  using namespace precice::testing::com::serverclient;
+  TestSendReceiveFourProcessesServerClient<SharedMemoryCommunication>(context);
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClientV2)
+{
+  PRECICE_TEST("A"_on(2_ranks), "B"_on(2_ranks), Require::Events);
+  using namespace precice::testing::com::serverclient;
+  TestSendReceiveFourProcessesServerClientV2<SharedMemoryCommunication>(context);
+}
+
+/// Messages many times larger than the ring buffers are transferred in chunks, also concurrently in both directions
+BOOST_AUTO_TEST_CASE(SmallBuffer)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
+  SharedMemoryCommunication com(".", 64);
+
+  const bool          isAcceptor = context.isNamed("A");
+  constexpr int       size       = 1000;
+  std::vector<double> mine(size);
+  std::vector<double> theirs(size);
+  for (int i = 0; i < size; ++i) {
+    mine[i]   = isAcceptor ? i : -i;
+    theirs[i] = isAcceptor ? -i : i;
+  }
+  const std::string message(size, isAcceptor ? 'a' : 'b');
+
+  if (isAcceptor) {
+    com.acceptConnection("process0", "process1", "", 0);
+  } else {
+    com.requestConnection("process0", "process1", "", 0, 1);
+  }
+
+  for (int iteration = 0; iteration < 10; ++iteration) {
+    // Blocking, one direction after the other
+    std::vector<double> received;
+    std::string         receivedMessage;
+    if (isAcceptor) {
+      com.send(mine, 0);
+      com.send(message, 0);
+      com.receive(received, 0);
+      com.receive(receivedMessage, 0);
+    } else {
+      com.receive(received, 0);
+      com.receive(receivedMessage, 0);
+      com.send(mine, 0);
+      com.send(message, 0);
+    }
+    BOOST_TEST(received == theirs, boost::test_tools::per_element());
+    BOOST_TEST(receivedMessage == std::string(size, isAcceptor ? 'b' : 'a'));
+
+    // Asynchronous, both directions at once
+    received.assign(size, 0.0);
+    auto sendRequest    = com.aSend(mine, 0);
+    auto receiveRequest = com.aReceive(received, 0);
+    sendRequest->wait();
+    receiveRequest->wait();
+    BOOST_TEST(received == theirs, boost::test_tools::per_element());
+  }
+
+  com.closeConnection();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SharedMemory
+BOOST_AUTO_TEST_SUITE_END() // Communication
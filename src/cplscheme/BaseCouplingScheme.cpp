@@ -1,10 +1,13 @@
 #include "BaseCouplingScheme.hpp"
 #include <Eigen/Core>
+#include <algorithm>
 #include <limits>
+#include <map>
 #include <math.h>
 #include <sstream>
 #include <stddef.h>
 #include <utility>
+#include <vector>
 #include "acceleration/Acceleration.hpp"
 #include "cplscheme/Constants.hpp"
 #include "cplscheme/CouplingData.hpp"
@@ -66,37 +69,92 @@ BaseCouplingScheme::BaseCouplingScheme(
   }
 }
 
+namespace {
+/// Groups the data by mesh ID, both maps are ordered and thus result in the same order on both participants
+std::map<int, std::vector<PtrCouplingData>> groupByMesh(const std::map<int, PtrCouplingData> &data)
+{
+  std::map<int, std::vector<PtrCouplingData>> groups;
+  for (const auto &pair : data) {
+    groups[pair.second->mesh->getID()].push_back(pair.second);
+  }
+  return groups;
+}
+} // namespace
+
 void BaseCouplingScheme::sendData(m2n::PtrM2N m2n, DataMap sendData)
 {
   PRECICE_TRACE();
-  std::vector<int> sentDataIDs;
   PRECICE_ASSERT(m2n.get() != nullptr);
   PRECICE_ASSERT(m2n->isConnected());
 
-  for (const DataMap::value_type &pair : sendData) {
-    int size = pair.second->values().size();
-    if (size > 0) {
-      m2n->send(pair.second->values().data(), size, pair.second->mesh->getID(), pair.second->getDimensions());
+  for (const auto &group : groupByMesh(sendData)) {
+    const auto &data = group.second;
+    if (data.size() == 1) {
+      int size = data.front()->values().size();
+      if (size > 0) {
+        m2n->send(data.front()->values().data(), size, group.first, data.front()->getDimensions());
+      }
+      continue;
+    }
+
+    int dimensions = 0;
+    for (const auto &entry : data) {
+      dimensions += entry->getDimensions();
+    }
+    const int vertices = data.front()->values().size() / data.front()->getDimensions();
+    _packedValues.resize(vertices * dimensions);
+    int offset = 0;
+    for (const auto &entry : data) {
+      const int entryDimensions = entry->getDimensions();
+      PRECICE_ASSERT(entry->values().size() == vertices * entryDimensions, entry->values().size(), vertices, entryDimensions);
+      for (int vertex = 0; vertex < vertices; ++vertex) {
+        std::copy_n(entry->values().data() + vertex * entryDimensions, entryDimensions, _packedValues.data() + vertex * dimensions + offset);
+      }
+      offset += entryDimensions;
+    }
+    if (not _packedValues.empty()) {
+      m2n->send(_packedValues.data(), _packedValues.size(), group.first, dimensions);
     }
-    sentDataIDs.push_back(pair.first);
   }
-  PRECICE_DEBUG("Number of sent data sets = " << sentDataIDs.size());
+  PRECICE_DEBUG("Number of sent data sets = " << sendData.size());
 }
 
 void BaseCouplingScheme::receiveData(m2n::PtrM2N m2n, DataMap receiveData)
 {
   PRECICE_TRACE();
-  std::vector<int> receivedDataIDs;
   PRECICE_ASSERT(m2n.get());
   PRECICE_ASSERT(m2n->isConnected());
-  for (DataMap::value_type &pair : receiveData) {
-    int size = pair.second->values().size();
-    if (size > 0) {
-      m2n->receive(pair.second->values().data(), size, pair.second->mesh->getID(), pair.second->getDimensions());
+
+  for (const auto &group : groupByMesh(receiveData)) {
+    const auto &data = group.second;
+    if (data.size() == 1) {
+      int size = data.front()->values().size();
+      if (size > 0) {
+        m2n->receive(data.front()->values().data(), size, group.first, data.front()->getDimensions());
+      }
+      continue;
+    }
+
+    int dimensions = 0;
+    for (const auto &entry : data) {
+      dimensions += entry->getDimensions();
+    }
+    const int vertices = data.front()->values().size() / data.front()->getDimensions();
+    _packedValues.resize(vertices * dimensions);
+    if (not _packedValues.empty()) {
+      m2n->receive(_packedValues.data(), _packedValues.size(), group.first, dimensions);
+    }
+    int offset = 0;
+    for (const auto &entry : data) {
+      const int entryDimensions = entry->getDimensions();
+      PRECICE_ASSERT(entry->values().size() == vertices * entryDimensions, entry->values().size(), vertices, entryDimensions);
+      for (int vertex = 0; vertex < vertices; ++vertex) {
+        std::copy_n(_packedValues.data() + vertex * dimensions + offset, entryDimensions, entry->values().data() + vertex * entryDimensions);
+      }
+      offset += entryDimensions;
     }
-    receivedDataIDs.push_back(pair.first);
   }
-  PRECICE_DEBUG("Number of received data sets = " << receivedDataIDs.size());
+  PRECICE_DEBUG("Number of received data sets = " << receiveData.size());
 }
 
 void BaseCouplingScheme::store(DataMap data)
@@ -254,12 +254,20 @@ protected:
   /// Map that links DataID to CouplingData
   typedef std::map<int, PtrCouplingData> DataMap;
 
-  /// Sends data sendDataIDs given in mapCouplingData with communication.
+  /**
+   * @brief Sends data sendDataIDs given in mapCouplingData with communication.
+   *
+   * All data of the same mesh is sent as a single message per remote rank, which
+   * interleaves the values of all data per vertex in the order of the data IDs.
+   */
   void sendData(m2n::PtrM2N m2n, DataMap sendData);
 
-  /// Receives data receiveDataIDs given in mapCouplingData with communication.
+  /// Receives data receiveDataIDs given in mapCouplingData with communication, the counterpart of sendData().
   void receiveData(m2n::PtrM2N m2n, DataMap receiveData);
 
+  /// Buffer for the interleaved values of all data of a mesh, reused by sendData() and receiveData()
+  std::vector<double> _packedValues;
+
   /**
    * @brief Used by storeData to take care of storing individual DataMap
    * @param data DataMap that will be stored
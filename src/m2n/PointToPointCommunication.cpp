@@ -12,6 +12,7 @@
 #include "com/CommunicateMesh.hpp"
 #include "com/Communication.hpp"
 #include "com/CommunicationFactory.hpp"
+#include "com/IndexedLayout.hpp"
 #include "com/Request.hpp"
 #include "logging/LogMacros.hpp"
 #include "m2n/DistributedCommunication.hpp"
@@ -387,8 +388,9 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
     int  globalRequesterRank = comMap.first;
     auto indices             = std::move(communicationMap[globalRequesterRank]);
 
-    _mappings.push_back({globalRequesterRank, std::move(indices), com::PtrRequest(), {}});
+    _mappings.push_back({globalRequesterRank, std::move(indices), com::PtrRequest(), {}, {}, false});
   }
+  findOwnedIndices();
   e4.stop();
   _isConnected = true;
 }
@@ -517,8 +519,9 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
     auto globalAcceptorRank = i.first;
     auto indices            = std::move(i.second);
 
-    _mappings.push_back({globalAcceptorRank, std::move(indices), com::PtrRequest(), {}});
+    _mappings.push_back({globalAcceptorRank, std::move(indices), com::PtrRequest(), {}, {}, false});
   }
+  findOwnedIndices();
   e4.stop();
   _isConnected = true;
 }
@@ -558,8 +561,9 @@ void PointToPointCommunication::completeSlavesConnection()
   mesh::Mesh::CommunicationMap localCommunicationMap = _mesh->getCommunicationMap();
 
   for (auto &i : _connectionDataVector) {
-    _mappings.push_back({i.remoteRank, std::move(localCommunicationMap[i.remoteRank]), i.request, {}});
+    _mappings.push_back({i.remoteRank, std::move(localCommunicationMap[i.remoteRank]), i.request, {}, {}, false});
   }
+  findOwnedIndices();
 }
 
 void PointToPointCommunication::closeConnection()
@@ -569,10 +573,11 @@ void PointToPointCommunication::closeConnection()
   if (not isConnected())
     return;
 
-  checkBufferedRequests(true);
+  waitForSendBuffers();
 
-  _communication.reset();
+  // Persistent requests are freed before the communication is closed
   _mappings.clear();
+  _communication.reset();
   _isConnected = false;
 }
 
@@ -586,19 +591,29 @@ void PointToPointCommunication::send(double const *itemsToSend,
   }
 
   for (auto &mapping : _mappings) {
-    // if (utils::MasterSlave::isMaster())
-    //   std::cout<< "indices " << mapping.indices << std::endl;
-    auto buffer = std::make_shared<std::vector<double>>();
-    buffer->reserve(mapping.indices.size() * valueDimension);
+    // Reuse a buffer of the same size, whose previous send has completed
+    const size_t bufferSize = mapping.indices.size() * valueDimension;
+    auto         buffer     = std::find_if(mapping.sendBuffers.begin(), mapping.sendBuffers.end(), [bufferSize](Buffer &candidate) {
+      return candidate.values.size() == bufferSize && (not candidate.request || candidate.request->test());
+    });
+    if (buffer == mapping.sendBuffers.end()) {
+      buffer = mapping.sendBuffers.emplace(mapping.sendBuffers.end());
+      buffer->values.resize(bufferSize);
+      buffer->persistentRequest = _communication->sendInit(buffer->values.data(), bufferSize, mapping.remoteRank);
+    }
+
+    auto packed = buffer->values.begin();
     for (auto index : mapping.indices) {
-      for (int d = 0; d < valueDimension; ++d) {
-        buffer->push_back(itemsToSend[index * valueDimension + d]);
-      }
+      packed = std::copy_n(itemsToSend + index * valueDimension, valueDimension, packed);
+    }
+
+    if (buffer->persistentRequest) {
+      buffer->persistentRequest->start();
+      buffer->request = buffer->persistentRequest;
+    } else {
+      buffer->request = _communication->aSend(buffer->values, mapping.remoteRank);
     }
-    auto request = _communication->aSend(*buffer, mapping.remoteRank);
-    bufferedRequests.emplace_back(request, buffer);
   }
-  checkBufferedRequests(false);
 }
 
 void PointToPointCommunication::receive(double *itemsToReceive,
@@ -612,19 +627,42 @@ void PointToPointCommunication::receive(double *itemsToReceive,
   std::fill(itemsToReceive, itemsToReceive + size, 0);
 
   for (auto &mapping : _mappings) {
-    // if (not utils::MasterSlave::isMaster())
-    //   std::cout<< "indices " << mapping.indices << std::endl;
-    mapping.recvBuffer.resize(mapping.indices.size() * valueDimension);
-    mapping.request = _communication->aReceive(mapping.recvBuffer, mapping.remoteRank);
+    auto buffer = mapping.recvBuffers.find(valueDimension);
+    if (buffer == mapping.recvBuffers.end()) {
+      buffer = mapping.recvBuffers.emplace(valueDimension, Buffer()).first;
+      if (mapping.ownsIndices) {
+        buffer->second.layout = _communication->createIndexedLayout(mapping.indices, valueDimension);
+      }
+      if (not buffer->second.layout) {
+        buffer->second.values.resize(mapping.indices.size() * valueDimension);
+        buffer->second.persistentRequest = _communication->receiveInit(buffer->second.values.data(), buffer->second.values.size(), mapping.remoteRank);
+      }
+    }
+
+    if (buffer->second.layout) {
+      mapping.request = _communication->aReceiveIndexed(itemsToReceive, *buffer->second.layout, mapping.remoteRank);
+    } else if (buffer->second.persistentRequest) {
+      buffer->second.persistentRequest->start();
+      mapping.request = buffer->second.persistentRequest;
+    } else {
+      mapping.request = _communication->aReceive(buffer->second.values, mapping.remoteRank);
+    }
   }
 
   for (auto &mapping : _mappings) {
     mapping.request->wait();
 
-    int i = 0;
+    const auto &buffer = mapping.recvBuffers[valueDimension];
+    if (buffer.layout) {
+      // The values have been received in place
+      continue;
+    }
+
+    const auto &values = buffer.values;
+    int         i      = 0;
     for (auto index : mapping.indices) {
       for (int d = 0; d < valueDimension; ++d) {
-        itemsToReceive[index * valueDimension + d] += mapping.recvBuffer[i * valueDimension + d];
+        itemsToReceive[index * valueDimension + d] += values[i * valueDimension + d];
       }
       i++;
     }
@@ -676,21 +714,33 @@ void PointToPointCommunication::gatherAllCommunicationMap(CommunicationMap &loca
   }
 }
 
-void PointToPointCommunication::checkBufferedRequests(bool blocking)
+void PointToPointCommunication::findOwnedIndices()
+{
+  PRECICE_TRACE();
+  std::map<int, int> counts;
+  for (const auto &mapping : _mappings) {
+    for (auto index : mapping.indices) {
+      ++counts[index];
+    }
+  }
+  for (auto &mapping : _mappings) {
+    mapping.ownsIndices = std::all_of(mapping.indices.begin(), mapping.indices.end(), [&counts](int index) {
+      return counts[index] == 1;
+    });
+  }
+}
+
+void PointToPointCommunication::waitForSendBuffers()
 {
-  PRECICE_TRACE(bufferedRequests.size());
-  do {
-    for (auto it = bufferedRequests.begin(); it != bufferedRequests.end();) {
-      if (it->first->test())
-        it = bufferedRequests.erase(it);
-      else
-        ++it;
+  PRECICE_TRACE();
+  for (auto &mapping : _mappings) {
+    for (auto &buffer : mapping.sendBuffers) {
+      if (buffer.request) {
+        buffer.request->wait();
+        buffer.request.reset();
+      }
     }
-    if (bufferedRequests.empty())
-      return;
-    if (blocking)
-      std::this_thread::yield(); // give up our time slice, so MPI may work
-  } while (blocking);
+  }
 }
 
 } // namespace m2n
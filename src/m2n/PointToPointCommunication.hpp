@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <list>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -127,11 +128,11 @@ public:
 private:
   logging::Logger _log{"m2n::PointToPointCommunication"};
 
-  /// Checks all stored requests for completion and removes associated buffers
-  /**
-   * @param[in] blocking False means that the function returns, even when there are requests left.
-   */
-  void checkBufferedRequests(bool blocking);
+  /// Waits for the completion of all pending sends
+  void waitForSendBuffers();
+
+  /// Marks the mappings whose indices are not communicated by any other mapping
+  void findOwnedIndices();
 
   com::PtrCommunicationFactory _communicationFactory;
 
@@ -141,6 +142,22 @@ private:
    **/
   com::PtrCommunication _communication;
 
+  /**
+   * @brief Buffer to pack or unpack the elements of one message.
+   *
+   * The size of the messages is fixed by the communication map, hence buffers are created
+   * once and reused for all further messages. Communications supporting persistent requests
+   * bind one to the buffer. Communications supporting indexed layouts receive the values
+   * of owned indices directly, without a buffer.
+   */
+  struct Buffer {
+    std::vector<double>       values;
+    com::PtrPersistentRequest persistentRequest;
+    com::PtrIndexedLayout     layout;
+    /// Request of the pending communication, nullptr if there is none
+    com::PtrRequest request;
+  };
+
   /**
    * @brief Defines mapping between:
    *        1. global remote process rank;
@@ -148,13 +165,18 @@ private:
    *           rank in the current participant) data to be communicated between
    *           the current process rank and the remote process rank;
    *        3. Request holding information about pending communication
-   *        4. Appropriately sized buffer to receive elements
+   *        4. Buffers to receive elements, one per value dimension
+   *        5. Buffers to send elements, several sends may be pending at once
+   *        6. Whether no other mapping communicates any of the indices, whose received values
+   *           then do not need to be accumulated
    */
   struct Mapping {
-    int                 remoteRank;
-    std::vector<int>    indices;
-    com::PtrRequest     request;
-    std::vector<double> recvBuffer;
+    int                   remoteRank;
+    std::vector<int>      indices;
+    com::PtrRequest       request;
+    std::map<int, Buffer> recvBuffers;
+    std::list<Buffer>     sendBuffers;
+    bool                  ownsIndices = false;
   };
 
   /**
@@ -182,10 +204,6 @@ private:
   std::vector<ConnectionData> _connectionDataVector;
 
   bool _isConnected = false;
-
-  std::list<std::pair<std::shared_ptr<com::Request>,
-                      std::shared_ptr<std::vector<double>>>>
-      bufferedRequests;
 };
 } // namespace m2n
 } // namespace precice
@@ -5,6 +5,7 @@
 #include "com/CommunicationFactory.hpp"
 #include "com/MPIPortsCommunicationFactory.hpp"
 #include "com/MPISinglePortsCommunicationFactory.hpp"
+#include "com/SharedMemoryCommunicationFactory.hpp"
 #include "com/SharedPointer.hpp"
 #include "com/SocketCommunicationFactory.hpp"
 #include "logging/LogMacros.hpp"
@@ -86,6 +87,20 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
     tags.push_back(tag);
   }
 
+  {
+    XMLTag tag(*this, "shared-memory", occ, TAG);
+    doc = "Communication via shared memory, for participants running on the same node.";
+    tag.setDocumentation(doc);
+
+    auto attrExchangeDirectory = makeXMLAttribute(ATTR_EXCHANGE_DIRECTORY, "")
+                                     .setDocumentation(
+                                         "Directory where connection information is exchanged. By default, the "
+                                         "directory of startup is chosen, and both solvers have to be started "
+                                         "in the same directory.");
+    tag.addAttribute(attrExchangeDirectory);
+    tags.push_back(tag);
+  }
+
   XMLAttribute<bool> attrEnforce(ATTR_ENFORCE_GATHER_SCATTER, false);
   attrEnforce.setDocumentation("Enforce the distributed communication to a gather-scatter scheme. "
                                "Only recommended for trouble shooting.");
@@ -174,6 +189,15 @@ void M2NConfiguration::xmlTagCallback(const xml::ConfigurationContext &context,
 #endif
       comFactory = std::make_shared<com::MPISinglePortsCommunicationFactory>(dir);
       com        = comFactory->newCommunication();
+#endif
+    } else if (tag.getName() == "shared-memory") {
+      std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
+#ifdef _WIN32
+      PRECICE_ERROR("Communication type \"shared-memory\" is not supported on Windows. "
+                    "Please switch to a \"sockets\" communication.");
+#else
+      comFactory = std::make_shared<com::SharedMemoryCommunicationFactory>(dir);
+      com        = comFactory->newCommunication();
 #endif
     }
 
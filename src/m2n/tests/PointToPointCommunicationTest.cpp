@@ -6,6 +6,7 @@
 #include <memory>
 #include <vector>
 #include "com/MPIPortsCommunicationFactory.hpp"
+#include "com/SharedMemoryCommunicationFactory.hpp"
 #include "com/SharedPointer.hpp"
 #include "com/SocketCommunicationFactory.hpp"
 #include "m2n/DistributedCommunication.hpp"
@@ -119,6 +120,68 @@ void runP2PComTest1(const TestContext &context, com::PtrCommunicationFactory cf)
   }
 }
 
+/// sends several fields of different dimensions repeatedly, which reuses the communication buffers
+void runRepeatedExchangeTest(const TestContext &context, com::PtrCommunicationFactory cf)
+{
+  BOOST_TEST(context.hasSize(2));
+
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, true, testing::nextMeshID()));
+
+  m2n::PointToPointCommunication c(cf, mesh);
+
+  // Global vertex indices of the local vertices, vertices 1 and 5 are shared by both ranks of A
+  vector<int> globalIndices;
+  if (context.isNamed("A")) {
+    if (context.isMaster()) {
+      mesh->setGlobalNumberOfVertices(10);
+      mesh->getVertexDistribution()[0] = {0, 1, 3, 5, 7};
+      mesh->getVertexDistribution()[1] = {1, 2, 4, 5, 6};
+      globalIndices                    = {0, 1, 3, 5, 7};
+    } else {
+      globalIndices = {1, 2, 4, 5, 6};
+    }
+    c.requestConnection("B", "A");
+  } else {
+    if (context.isMaster()) {
+      mesh->setGlobalNumberOfVertices(10);
+      mesh->getVertexDistribution()[0] = {1, 2, 5, 6};
+      mesh->getVertexDistribution()[1] = {0, 1, 3, 4, 5, 7};
+      globalIndices                    = {1, 2, 5, 6};
+    } else {
+      globalIndices = {0, 1, 3, 4, 5, 7};
+    }
+    c.acceptConnection("B", "A");
+  }
+
+  auto value = [](int globalIndex, int component, int iteration) {
+    return 10.0 * globalIndex + component + 100.0 * iteration;
+  };
+
+  for (int iteration = 0; iteration < 3; ++iteration) {
+    for (int valueDimension : {1, 3, 1}) {
+      vector<double> data(globalIndices.size() * valueDimension);
+      if (context.isNamed("A")) {
+        for (size_t i = 0; i < globalIndices.size(); ++i) {
+          for (int d = 0; d < valueDimension; ++d) {
+            data[i * valueDimension + d] = value(globalIndices[i], d, iteration);
+          }
+        }
+        c.send(data.data(), data.size(), valueDimension);
+      } else {
+        c.receive(data.data(), data.size(), valueDimension);
+        vector<double> expectedData(data.size());
+        for (size_t i = 0; i < globalIndices.size(); ++i) {
+          const int multiplicity = (globalIndices[i] == 1 || globalIndices[i] == 5) ? 2 : 1;
+          for (int d = 0; d < valueDimension; ++d) {
+            expectedData[i * valueDimension + d] = multiplicity * value(globalIndices[i], d, iteration);
+          }
+        }
+        BOOST_TEST(data == expectedData);
+      }
+    }
+  }
+}
+
 /// a very similar test, but with a vertex that has been completely filtered out
 void runP2PComTest2(const TestContext &context, com::PtrCommunicationFactory cf)
 {
@@ -520,6 +583,13 @@ BOOST_AUTO_TEST_CASE(P2PComTest2)
   runP2PComTest2(context, cf);
 }
 
+BOOST_AUTO_TEST_CASE(RepeatedExchange)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  runRepeatedExchangeTest(context, cf);
+}
+
 BOOST_AUTO_TEST_CASE(TestSameConnection)
 {
   PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
@@ -557,6 +627,66 @@ BOOST_AUTO_TEST_CASE(P2PComLocalCommunicationMapTest)
 
 BOOST_AUTO_TEST_SUITE_END() // Sockets
 
+BOOST_AUTO_TEST_SUITE(SharedMemory)
+
+BOOST_AUTO_TEST_CASE(P2PComTest1)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SharedMemoryCommunicationFactory);
+  runP2PComTest1(context, cf);
+}
+
+BOOST_AUTO_TEST_CASE(P2PComTest2)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SharedMemoryCommunicationFactory);
+  runP2PComTest2(context, cf);
+}
+
+BOOST_AUTO_TEST_CASE(RepeatedExchange)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SharedMemoryCommunicationFactory);
+  runRepeatedExchangeTest(context, cf);
+}
+
+BOOST_AUTO_TEST_CASE(TestSameConnection)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SharedMemoryCommunicationFactory);
+  runSameConnectionTest(context, cf);
+}
+
+BOOST_AUTO_TEST_CASE(TestCrossConnection)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SharedMemoryCommunicationFactory);
+  runCrossConnectionTest(context, cf);
+}
+
+BOOST_AUTO_TEST_CASE(EmptyConnectionTest)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SharedMemoryCommunicationFactory);
+  runEmptyConnectionTest(context, cf);
+}
+
+BOOST_AUTO_TEST_CASE(P2PMeshBroadcastTest)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SharedMemoryCommunicationFactory);
+  runP2PMeshBroadcastTest(context, cf);
+}
+
+BOOST_AUTO_TEST_CASE(P2PComLocalCommunicationMapTest)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SharedMemoryCommunicationFactory);
+  runP2PComLocalCommunicationMapTest(context, cf);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SharedMemory
+
 BOOST_AUTO_TEST_SUITE(MPIPorts, *boost::unit_test::label("MPI_Ports"))
 
 BOOST_AUTO_TEST_CASE(P2PComTest1)
@@ -573,6 +703,13 @@ BOOST_AUTO_TEST_CASE(P2PComTest2)
   runP2PComTest2(context, cf);
 }
 
+BOOST_AUTO_TEST_CASE(RepeatedExchange)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::MPIPortsCommunicationFactory);
+  runRepeatedExchangeTest(context, cf);
+}
+
 BOOST_AUTO_TEST_CASE(TestSameConnection)
 {
   PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
@@ -1,6 +1,13 @@
 #include "Mapping.hpp"
 #include <boost/config.hpp>
+#include <functional>
 #include <ostream>
+#include <unordered_map>
+#include <utility>
+#include "logging/LogMacros.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Vertex.hpp"
+#include "utils/Event.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
@@ -18,6 +25,18 @@ Mapping::Mapping(
 {
 }
 
+void Mapping::mapBatch(const DataIDPairs &dataIDs)
+{
+  for (const auto &ids : dataIDs) {
+    map(ids.first, ids.second);
+  }
+}
+
+bool Mapping::canMapConcurrently() const
+{
+  return false;
+}
+
 void Mapping::setMeshes(
     const mesh::PtrMesh &input,
     const mesh::PtrMesh &output)
@@ -51,6 +70,91 @@ Mapping::MeshRequirement Mapping::getOutputRequirement() const
   return _outputRequirement;
 }
 
+const SparseOperator &Mapping::getInterpolationOperator() const
+{
+  return _interpolationOperator;
+}
+
+void Mapping::setInterpolationOperator(SparseOperator interpolationOperator)
+{
+  _interpolationOperator = std::move(interpolationOperator);
+}
+
+void Mapping::mapWithInterpolationOperator(int inputDataID, int outputDataID) const
+{
+  const mesh::PtrData inputData       = input()->data(inputDataID);
+  const mesh::PtrData outputData      = output()->data(outputDataID);
+  const int           valueDimensions = inputData->getDimensions();
+  PRECICE_ASSERT(valueDimensions == outputData->getDimensions(), valueDimensions, outputData->getDimensions());
+  PRECICE_ASSERT(_interpolationOperator.rows() == static_cast<int>(output()->vertices().size()),
+                 _interpolationOperator.rows(), output()->vertices().size());
+  PRECICE_ASSERT(_interpolationOperator.cols() == static_cast<int>(input()->vertices().size()),
+                 _interpolationOperator.cols(), input()->vertices().size());
+  _interpolationOperator.apply(inputData->values(), outputData->values(), valueDimensions);
+}
+
+namespace {
+/// Hashes the coordinates of a vertex, adding 0.0 maps -0.0 to 0.0 as they compare equal
+std::size_t hashCoords(const mesh::Vertex::RawCoords &coords)
+{
+  std::size_t seed = 0;
+  for (int d = 0; d < coords.size(); ++d) {
+    seed ^= std::hash<double>{}(coords[d] + 0.0) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  }
+  return seed;
+}
+} // namespace
+
+bool Mapping::findMatchingVertices(std::vector<int> &matches) const
+{
+  PRECICE_TRACE();
+  const auto &inVertices  = input()->vertices();
+  const auto &outVertices = output()->vertices();
+  if (inVertices.empty() || inVertices.size() != outVertices.size()) {
+    return false;
+  }
+  precice::utils::Event e("map.findMatchingVertices.From" + input()->getName() + "To" + output()->getName());
+
+  std::unordered_multimap<std::size_t, int> candidates;
+  candidates.reserve(inVertices.size());
+  for (size_t i = 0; i < inVertices.size(); ++i) {
+    candidates.emplace(hashCoords(inVertices[i].getCoords()), static_cast<int>(i));
+  }
+
+  // Matched candidates are removed, such that duplicated vertices match distinct input vertices.
+  // Choosing the first remaining duplicate keeps their order, thus identical meshes result in the identity.
+  matches.resize(outVertices.size());
+  for (size_t i = 0; i < outVertices.size(); ++i) {
+    const auto &coords = outVertices[i].getCoords();
+    auto        range  = candidates.equal_range(hashCoords(coords));
+    auto        match  = range.second;
+    for (auto candidate = range.first; candidate != range.second; ++candidate) {
+      if (inVertices[candidate->second].getCoords() == coords && (match == range.second || candidate->second < match->second)) {
+        match = candidate;
+      }
+    }
+    if (match == range.second) {
+      return false;
+    }
+    matches[i] = match->second;
+    candidates.erase(match);
+  }
+  PRECICE_DEBUG("The vertices of mesh " << input()->getName() << " match the vertices of mesh " << output()->getName());
+  return true;
+}
+
+void Mapping::setPermutationOperator(const std::vector<int> &matches)
+{
+  PRECICE_ASSERT(matches.size() == output()->vertices().size(), matches.size(), output()->vertices().size());
+  // The operator of consistent and conservative mappings is the same, as the transposed inverse of a permutation is the permutation itself
+  std::vector<SparseOperator::Triplet> entries;
+  entries.reserve(matches.size());
+  for (size_t i = 0; i < matches.size(); ++i) {
+    entries.emplace_back(static_cast<int>(i), matches[i], 1.0);
+  }
+  setInterpolationOperator(SparseOperator(output()->vertices().size(), input()->vertices().size(), entries));
+}
+
 mesh::PtrMesh Mapping::input() const
 {
   return _input;
@@ -78,6 +182,16 @@ int Mapping::getDimensions() const
   return _dimensions;
 }
 
+void Mapping::setCache(std::shared_ptr<MappingCache> cache)
+{
+  _cache = std::move(cache);
+}
+
+const std::shared_ptr<MappingCache> &Mapping::getCache() const
+{
+  return _cache;
+}
+
 bool operator<(Mapping::MeshRequirement lhs, Mapping::MeshRequirement rhs)
 {
   switch (lhs) {
@@ -1,11 +1,17 @@
 #pragma once
 
 #include <iosfwd>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "logging/Logger.hpp"
+#include "mapping/SparseOperator.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
 
 namespace precice {
 namespace mapping {
+class MappingCache;
 
 /**
  * @brief Abstract base class for mapping of data from one mesh to another.
@@ -43,6 +49,9 @@ public:
     FULL = 2
   };
 
+  /// Pairs of input and output data IDs to map
+  using DataIDPairs = std::vector<std::pair<int, int>>;
+
   /// Constructor, takes mapping constraint.
   Mapping(Constraint constraint, int dimensions);
 
@@ -74,6 +83,13 @@ public:
   /// Returns the requirement on the output mesh.
   MeshRequirement getOutputRequirement() const;
 
+  /**
+   * @brief Returns the interpolation operator of the computed mapping.
+   *
+   * The operator is empty for mappings which do not map via an operator.
+   */
+  const SparseOperator &getInterpolationOperator() const;
+
   /// Computes the mapping coefficients from the in- and output mesh.
   virtual void computeMapping() = 0;
 
@@ -100,6 +116,33 @@ public:
       int inputDataID,
       int outputDataID) = 0;
 
+  /**
+   * @brief Maps several data fields using this mapping at once.
+   *
+   * The default implementation calls map() for every pair. Mappings which can map all
+   * components of all fields in a single pass override this.
+   *
+   * Pre-conditions:
+   * - hasComputedMapping() returns true
+   */
+  virtual void mapBatch(const DataIDPairs &dataIDs);
+
+  /**
+   * @brief Returns true, if map() may run concurrently to map() of other mappings.
+   *
+   * This requires map() to neither communicate nor modify state shared with other mappings.
+   * The default implementation returns false.
+   */
+  virtual bool canMapConcurrently() const;
+
+  /**
+   * @brief Sets the on-disk cache of computed mappings.
+   *
+   * Mappings supporting the cache load their coefficients from it if possible,
+   * instead of computing them. Passing nullptr disables the cache.
+   */
+  void setCache(std::shared_ptr<MappingCache> cache);
+
   /// Method used by partition. Tags vertices that could be owned by this rank.
   virtual void tagMeshFirstRound() = 0;
 
@@ -121,7 +164,32 @@ protected:
 
   int getDimensions() const;
 
+  /// Returns the on-disk cache of computed mappings, nullptr if disabled.
+  const std::shared_ptr<MappingCache> &getCache() const;
+
+  /// Sets the interpolation operator computed by computeMapping(), an empty operator removes it
+  void setInterpolationOperator(SparseOperator interpolationOperator);
+
+  /// Maps data by applying the interpolation operator
+  void mapWithInterpolationOperator(int inputDataID, int outputDataID) const;
+
+  /**
+   * @brief Detects input and output meshes consisting of the same vertices, possibly in a different order.
+   *
+   * Candidates are found by hashing the vertex coordinates and verified by comparing the coordinates exactly.
+   * Every mapping reduces to the identity or a permutation for such meshes.
+   *
+   * @param[out] matches the index of the matching input vertex for every output vertex
+   * @return true if the meshes have the same size and every output vertex matches a distinct input vertex
+   */
+  bool findMatchingVertices(std::vector<int> &matches) const;
+
+  /// Sets the interpolation operator to the permutation found by findMatchingVertices()
+  void setPermutationOperator(const std::vector<int> &matches);
+
 private:
+  mutable logging::Logger _log{"mapping::Mapping"};
+
   /// Determines wether mapping is consistent or conservative.
   Constraint _constraint;
 
@@ -138,6 +206,12 @@ private:
   mesh::PtrMesh _output;
 
   int _dimensions;
+
+  /// Optional on-disk cache of computed mappings.
+  std::shared_ptr<MappingCache> _cache;
+
+  /// Interpolation operator from input to output vertices, used by mapWithInterpolationOperator()
+  SparseOperator _interpolationOperator;
 };
 
 /** Defines an ordering for MeshRequirement in terms of specificality
@@ -0,0 +1,180 @@
+#include "MappingCache.hpp"
+#include <boost/filesystem.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <utility>
+#include "logging/LogMacros.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Triangle.hpp"
+#include "mesh/Vertex.hpp"
+#include "utils/SHA1.hpp"
+
+namespace precice {
+namespace mapping {
+
+namespace {
+
+/// Identifies cache files and their layout, increase the version when changing the layout
+const std::string fileHeader{"precice-mapping-cache-2"};
+
+class MeshHasher {
+public:
+  template <typename T>
+  void process(const T &value)
+  {
+    _sha1.processBytes(&value, sizeof(T));
+  }
+
+  void process(const std::string &value)
+  {
+    process(value.size());
+    _sha1.processBytes(value.data(), value.size());
+  }
+
+  void process(const mesh::Mesh &mesh)
+  {
+    process(mesh.getDimensions());
+    process(mesh.vertices().size());
+    for (const auto &vertex : mesh.vertices()) {
+      const auto &coords = vertex.getCoords();
+      _sha1.processBytes(coords.data(), coords.size() * sizeof(double));
+    }
+    process(mesh.edges().size());
+    for (const auto &edge : mesh.edges()) {
+      process(edge.vertex(0).getID());
+      process(edge.vertex(1).getID());
+    }
+    process(mesh.triangles().size());
+    for (const auto &triangle : mesh.triangles()) {
+      process(triangle.vertex(0).getID());
+      process(triangle.vertex(1).getID());
+      process(triangle.vertex(2).getID());
+    }
+  }
+
+  std::string hexDigest()
+  {
+    return _sha1.hexDigest();
+  }
+
+private:
+  utils::SHA1 _sha1;
+};
+
+template <typename T>
+void writeVector(std::ostream &out, const std::vector<T> &values)
+{
+  const std::uint64_t size = values.size();
+  out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+  out.write(reinterpret_cast<const char *>(values.data()), size * sizeof(T));
+}
+
+/// Reads a vector written by writeVector(), fails if the vector is larger than maxBytes
+template <typename T>
+bool readVector(std::istream &in, std::vector<T> &values, std::uintmax_t maxBytes)
+{
+  std::uint64_t size = 0;
+  if (!in.read(reinterpret_cast<char *>(&size), sizeof(size)) || size > maxBytes / sizeof(T)) {
+    return false;
+  }
+  values.resize(size);
+  return static_cast<bool>(in.read(reinterpret_cast<char *>(values.data()), size * sizeof(T)));
+}
+
+} // namespace
+
+MappingCache::MappingCache(std::string directory)
+    : _directory(std::move(directory))
+{
+}
+
+std::string MappingCache::computeKey(const std::string &description, const mesh::Mesh &input, const mesh::Mesh &output)
+{
+  MeshHasher hasher;
+  hasher.process(description);
+  hasher.process(input);
+  hasher.process(output);
+  return hasher.hexDigest();
+}
+
+bool MappingCache::load(const std::string &key, const mesh::Mesh &input, const mesh::Mesh &output, Entry &entry) const
+{
+  PRECICE_TRACE(key);
+  std::ifstream in(getFilename(key), std::ios::binary);
+  if (!in) {
+    PRECICE_DEBUG("No cached mapping found for key " << key);
+    return false;
+  }
+
+  std::string header, storedKey;
+  if (!std::getline(in, header) || header != fileHeader || !std::getline(in, storedKey) || storedKey != key) {
+    PRECICE_WARN("Ignoring the mapping cache file \"" << getFilename(key) << "\" as it was written by an incompatible version of preCICE.");
+    return false;
+  }
+
+  // Guards against colliding keys, as the entry references the vertices of both meshes
+  std::uint64_t inputSize = 0, outputSize = 0;
+  if (!in.read(reinterpret_cast<char *>(&inputSize), sizeof(inputSize)) || !in.read(reinterpret_cast<char *>(&outputSize), sizeof(outputSize)) ||
+      inputSize != input.vertices().size() || outputSize != output.vertices().size()) {
+    PRECICE_WARN("Ignoring the mapping cache file \"" << getFilename(key) << "\" as it was computed for meshes of different sizes.");
+    return false;
+  }
+
+  boost::system::error_code ec;
+  const auto                fileSize = boost::filesystem::file_size(getFilename(key), ec);
+  Entry                     loaded;
+  if (ec || !readVector(in, loaded.offsets, fileSize) || !readVector(in, loaded.indices, fileSize) || !readVector(in, loaded.weights, fileSize)) {
+    PRECICE_WARN("Ignoring the mapping cache file \"" << getFilename(key) << "\" as it is incomplete.");
+    return false;
+  }
+  entry = std::move(loaded);
+  return true;
+}
+
+void MappingCache::store(const std::string &key, const mesh::Mesh &input, const mesh::Mesh &output, const Entry &entry) const
+{
+  PRECICE_TRACE(key);
+  namespace fs = boost::filesystem;
+  try {
+    fs::create_directories(_directory);
+
+    // Write to a unique file first, as other ranks or participants may store the same entry concurrently
+    const fs::path target    = getFilename(key);
+    const fs::path temporary = target.parent_path() / fs::unique_path(key + "-%%%%-%%%%-%%%%");
+    {
+      std::ofstream out(temporary.string(), std::ios::binary);
+      out << fileHeader << '\n'
+          << key << '\n';
+      const std::uint64_t inputSize  = input.vertices().size();
+      const std::uint64_t outputSize = output.vertices().size();
+      out.write(reinterpret_cast<const char *>(&inputSize), sizeof(inputSize));
+      out.write(reinterpret_cast<const char *>(&outputSize), sizeof(outputSize));
+      writeVector(out, entry.offsets);
+      writeVector(out, entry.indices);
+      writeVector(out, entry.weights);
+      if (!out) {
+        PRECICE_WARN("Unable to write the mapping cache file \"" << temporary.string() << "\". The computed mapping will not be cached.");
+        fs::remove(temporary);
+        return;
+      }
+    }
+    fs::rename(temporary, target);
+  } catch (const fs::filesystem_error &e) {
+    PRECICE_WARN("Unable to store the computed mapping in the cache directory \"" << _directory << "\": " << e.what());
+  }
+}
+
+const std::string &MappingCache::getDirectory() const
+{
+  return _directory;
+}
+
+std::string MappingCache::getFilename(const std::string &key) const
+{
+  return (boost::filesystem::path(_directory) / (key + ".mapping")).string();
+}
+
+} // namespace mapping
+} // namespace precice
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace mesh {
+class Mesh;
+} // namespace mesh
+
+namespace mapping {
+
+/**
+ * @brief On-disk cache of computed mappings, which persists across runs.
+ *
+ * Every entry is stored in a separate file of the cache directory. The file name is
+ * a content hash of the input and output meshes and a description of the mapping.
+ * Hence, only bit-identical meshes of later runs reuse a stored entry.
+ *
+ * An entry stores the mapping as a sparse matrix in compressed row storage. Each row
+ * corresponds to an origin vertex and references positions of vertices in the
+ * vertex container of the searched mesh, i.e. mesh::Mesh::vertices().
+ * The vertex counts of both meshes are stored along and checked before an entry is used.
+ */
+class MappingCache {
+public:
+  /// A computed mapping in compressed row storage, offsets and weights may be empty if unused
+  struct Entry {
+    std::vector<int>    offsets;
+    std::vector<int>    indices;
+    std::vector<double> weights;
+  };
+
+  /// Creates a cache storing its entries in the given directory
+  explicit MappingCache(std::string directory);
+
+  /**
+   * @brief Computes the key of a mapping between the given meshes.
+   *
+   * @param[in] description unique description of the mapping type and its settings
+   * @param[in] input the input mesh of the mapping
+   * @param[in] output the output mesh of the mapping
+   */
+  static std::string computeKey(const std::string &description, const mesh::Mesh &input, const mesh::Mesh &output);
+
+  /// Loads the entry of the given key, returns false if there is no readable entry for meshes of the given sizes
+  bool load(const std::string &key, const mesh::Mesh &input, const mesh::Mesh &output, Entry &entry) const;
+
+  /// Stores the entry of a mapping between the given meshes under the given key, replacing an existing entry
+  void store(const std::string &key, const mesh::Mesh &input, const mesh::Mesh &output, const Entry &entry) const;
+
+  const std::string &getDirectory() const;
+
+private:
+  mutable logging::Logger _log{"mapping::MappingCache"};
+
+  std::string getFilename(const std::string &key) const;
+
+  std::string _directory;
+};
+
+} // namespace mapping
+} // namespace precice
@@ -1,10 +1,14 @@
 #include "NearestNeighborMapping.hpp"
 
 #include <Eigen/Core>
+#include <algorithm>
 #include <boost/container/flat_set.hpp>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <utility>
 #include "logging/LogMacros.hpp"
+#include "mapping/MappingCache.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
@@ -12,6 +16,7 @@
 #include "query/Index.hpp"
 #include "utils/Event.hpp"
 #include "utils/Statistics.hpp"
+#include "utils/Threads.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
@@ -19,6 +24,11 @@ extern bool syncMode;
 
 namespace mapping {
 
+namespace {
+/// Minimal number of vertices per thread, smaller meshes are not worth the thread overhead
+constexpr size_t minVerticesPerThread = 4096;
+} // namespace
+
 NearestNeighborMapping::NearestNeighborMapping(
     Constraint constraint,
     int        dimensions)
@@ -38,50 +48,107 @@ void NearestNeighborMapping::computeMapping()
   const std::string     baseEvent = "map.nn.computeMapping.From" + input()->getName() + "To" + output()->getName();
   precice::utils::Event e(baseEvent, precice::syncMode);
 
+  // Consistent mappings search the closest input vertex of every output vertex, conservative mappings vice versa
+  mesh::PtrMesh searchMesh = input();
+  mesh::PtrMesh originMesh = output();
   if (getConstraint() == CONSISTENT) {
     PRECICE_DEBUG("Compute consistent mapping");
-    precice::utils::Event e2(baseEvent + ".getIndexOnVertices", precice::syncMode);
-    query::Index          indexTree(input());
-    e2.stop();
-    size_t verticesSize = output()->vertices().size();
-    _vertexIndices.resize(verticesSize);
-    utils::statistics::DistanceAccumulator distanceStatistics;
-    const mesh::Mesh::VertexContainer &    outputVertices = output()->vertices();
-    // Search for the output vertex inside the input mesh and add index to _vertexIndices
-    for (size_t i = 0; i < verticesSize; i++) {
-      auto matchedVertex = indexTree.getClosestVertex(outputVertices[i]);
-      _vertexIndices[i]  = matchedVertex.index;
-      distanceStatistics(matchedVertex.distance);
-    }
-    if (distanceStatistics.empty()) {
-      PRECICE_INFO("Mapping distance not available due to empty partition.");
-    } else {
-      PRECICE_INFO("Mapping distance " << distanceStatistics);
-    }
   } else {
     PRECICE_ASSERT(getConstraint() == CONSERVATIVE, getConstraint());
     PRECICE_DEBUG("Compute conservative mapping");
-    precice::utils::Event e2(baseEvent + ".getIndexOnVertices", precice::syncMode);
-    query::Index          indexTree(output());
-    e2.stop();
-    size_t verticesSize = input()->vertices().size();
-    _vertexIndices.resize(verticesSize);
-    utils::statistics::DistanceAccumulator distanceStatistics;
-    const mesh::Mesh::VertexContainer &    inputVertices = input()->vertices();
-    for (size_t i = 0; i < verticesSize; i++) {
-      auto matchedVertex = indexTree.getClosestVertex(inputVertices[i]);
-      _vertexIndices[i]  = matchedVertex.index;
-      distanceStatistics(matchedVertex.distance);
-    }
-    if (distanceStatistics.empty()) {
-      PRECICE_INFO("Mapping distance not available due to empty partition.");
+    std::swap(searchMesh, originMesh);
+  }
+
+  // Matching meshes reduce to a permutation, which requires neither an index tree nor the cache
+  std::vector<int> matchingVertices;
+  if (findMatchingVertices(matchingVertices)) {
+    if (getConstraint() == CONSISTENT) {
+      _vertexIndices = std::move(matchingVertices);
     } else {
-      PRECICE_INFO("Mapping distance " << distanceStatistics);
+      _vertexIndices.resize(matchingVertices.size());
+      for (size_t i = 0; i < matchingVertices.size(); i++) {
+        _vertexIndices[matchingVertices[i]] = static_cast<int>(i);
+      }
+    }
+    computeInterpolationOperator();
+    _hasComputedMapping = true;
+    return;
+  }
+
+  std::string cacheKey;
+  if (getCache()) {
+    cacheKey = MappingCache::computeKey(getConstraint() == CONSISTENT ? "nearest-neighbor-consistent" : "nearest-neighbor-conservative", *input(), *output());
+    MappingCache::Entry entry;
+    const size_t        searchSize = searchMesh->vertices().size();
+    if (getCache()->load(cacheKey, *input(), *output(), entry) && entry.indices.size() == originMesh->vertices().size() &&
+        std::all_of(entry.indices.begin(), entry.indices.end(), [searchSize](int index) { return index >= 0 && static_cast<size_t>(index) < searchSize; })) {
+      PRECICE_INFO("Loaded the mapping from the cache directory \"" << getCache()->getDirectory() << "\"");
+      _vertexIndices = std::move(entry.indices);
+      computeInterpolationOperator();
+      _hasComputedMapping = true;
+      return;
     }
   }
+
+  precice::utils::Event e2(baseEvent + ".getIndexOnVertices", precice::syncMode);
+  query::Index          indexTree(searchMesh);
+  e2.stop();
+
+  const mesh::Mesh::VertexContainer &originVertices = originMesh->vertices();
+  const size_t                       verticesSize   = originVertices.size();
+  Eigen::MatrixXd                    positions(getDimensions(), verticesSize);
+  for (size_t i = 0; i < verticesSize; i++) {
+    positions.col(i) = originVertices[i].getCoords();
+  }
+
+  // Search for the origin vertices inside the search mesh and add the indices to _vertexIndices
+  const auto matches = indexTree.getClosestVertices(positions);
+  _vertexIndices.resize(verticesSize);
+  utils::statistics::DistanceAccumulator distanceStatistics;
+  std::mutex                             statisticsMutex;
+  utils::parallelFor(verticesSize, minVerticesPerThread, [&](size_t begin, size_t end) {
+    utils::statistics::DistanceAccumulator localStatistics;
+    for (size_t i = begin; i < end; i++) {
+      _vertexIndices[i] = matches[i].index;
+      localStatistics(matches[i].distance);
+    }
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    distanceStatistics.merge(localStatistics);
+  });
+  if (distanceStatistics.empty()) {
+    PRECICE_INFO("Mapping distance not available due to empty partition.");
+  } else {
+    PRECICE_INFO("Mapping distance " << distanceStatistics);
+  }
+
+  if (getCache()) {
+    MappingCache::Entry entry;
+    entry.indices = _vertexIndices;
+    getCache()->store(cacheKey, *input(), *output(), entry);
+  }
+  computeInterpolationOperator();
   _hasComputedMapping = true;
 }
 
+void NearestNeighborMapping::computeInterpolationOperator()
+{
+  PRECICE_TRACE();
+  const int inSize  = input()->vertices().size();
+  const int outSize = output()->vertices().size();
+
+  // Consistent mappings copy from the matched input vertex, conservative mappings sum up all matches of an output vertex
+  std::vector<SparseOperator::Triplet> entries;
+  entries.reserve(_vertexIndices.size());
+  for (size_t i = 0; i < _vertexIndices.size(); i++) {
+    if (getConstraint() == CONSISTENT) {
+      entries.emplace_back(static_cast<int>(i), _vertexIndices[i], 1.0);
+    } else {
+      entries.emplace_back(_vertexIndices[i], static_cast<int>(i), 1.0);
+    }
+  }
+  setInterpolationOperator(SparseOperator(outSize, inSize, entries));
+}
+
 bool NearestNeighborMapping::hasComputedMapping() const
 {
   PRECICE_TRACE(_hasComputedMapping);
@@ -92,12 +159,8 @@ void NearestNeighborMapping::clear()
 {
   PRECICE_TRACE();
   _vertexIndices.clear();
+  setInterpolationOperator(SparseOperator());
   _hasComputedMapping = false;
-  if (getConstraint() == CONSISTENT) {
-    query::clearCache(input()->getID());
-  } else {
-    query::clearCache(output()->getID());
-  }
 }
 
 void NearestNeighborMapping::map(
@@ -108,36 +171,13 @@ void NearestNeighborMapping::map(
 
   precice::utils::Event e("map.nn.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
 
-  const Eigen::VectorXd &inputValues  = input()->data(inputDataID)->values();
-  Eigen::VectorXd &      outputValues = output()->data(outputDataID)->values();
-  //assign(outputValues) = 0.0;
-  int valueDimensions = input()->data(inputDataID)->getDimensions();
-  PRECICE_ASSERT(valueDimensions == output()->data(outputDataID)->getDimensions(),
-                 valueDimensions, output()->data(outputDataID)->getDimensions());
-  PRECICE_ASSERT(inputValues.size() / valueDimensions == (int) input()->vertices().size(),
-                 inputValues.size(), valueDimensions, input()->vertices().size());
-  PRECICE_ASSERT(outputValues.size() / valueDimensions == (int) output()->vertices().size(),
-                 outputValues.size(), valueDimensions, output()->vertices().size());
-  if (getConstraint() == CONSISTENT) {
-    PRECICE_DEBUG("Map consistent");
-    size_t const outSize = output()->vertices().size();
-    for (size_t i = 0; i < outSize; i++) {
-      int inputIndex = _vertexIndices[i] * valueDimensions;
-      for (int dim = 0; dim < valueDimensions; dim++) {
-        outputValues((i * valueDimensions) + dim) = inputValues(inputIndex + dim);
-      }
-    }
-  } else {
-    PRECICE_ASSERT(getConstraint() == CONSERVATIVE, getConstraint());
-    PRECICE_DEBUG("Map conservative");
-    size_t const inSize = input()->vertices().size();
-    for (size_t i = 0; i < inSize; i++) {
-      int const outputIndex = _vertexIndices[i] * valueDimensions;
-      for (int dim = 0; dim < valueDimensions; dim++) {
-        outputValues(outputIndex + dim) += inputValues((i * valueDimensions) + dim);
-      }
-    }
-  }
+  PRECICE_ASSERT(_hasComputedMapping);
+  mapWithInterpolationOperator(inputDataID, outputDataID);
+}
+
+bool NearestNeighborMapping::canMapConcurrently() const
+{
+  return true;
 }
 
 void NearestNeighborMapping::tagMeshFirstRound()
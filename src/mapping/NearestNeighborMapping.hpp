@@ -36,6 +36,9 @@ public:
       int inputDataID,
       int outputDataID) override;
 
+  /// Returns true, as map() only uses the precomputed mapping.
+  virtual bool canMapConcurrently() const override;
+
   virtual void tagMeshFirstRound() override;
   virtual void tagMeshSecondRound() override;
 
@@ -47,6 +50,9 @@ private:
 
   /// Computed output vertex indices to map data from input vertices to.
   std::vector<int> _vertexIndices;
+
+  /// Sets the interpolation operator with unit weights from _vertexIndices.
+  void computeInterpolationOperator();
 };
 
 } // namespace mapping
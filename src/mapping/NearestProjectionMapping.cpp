@@ -4,12 +4,14 @@
 #include <algorithm>
 #include <deque>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <unordered_set>
 #include <utility>
 
 #include "logging/LogMacros.hpp"
 #include "mapping/Mapping.hpp"
+#include "mapping/MappingCache.hpp"
 #include "math/differences.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
@@ -19,6 +21,7 @@
 #include "query/Index.hpp"
 #include "utils/Event.hpp"
 #include "utils/Statistics.hpp"
+#include "utils/Threads.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
@@ -42,18 +45,50 @@ NearestProjectionMapping::NearestProjectionMapping(
 }
 
 namespace {
-struct MatchType {
-  double distance;
-  int    index;
-
-  MatchType() = default;
-  MatchType(double d, int i)
-      : distance(d), index(i){};
-  constexpr bool operator<(MatchType const &other) const
-  {
-    return distance < other.distance;
-  };
-};
+/// Minimal number of vertices per thread, smaller meshes are not worth the thread overhead
+constexpr size_t minVerticesPerThread = 1024;
+
+/// Amount of nearest elements to fetch for detailed comparison, which counters the loss of detail due to bounding box generation
+constexpr int nnearest = 4;
+
+/**
+ * @brief Projects the vertex onto the closest of its nnearest primitives with a valid projection.
+ *
+ * The primitives are fetched incrementally. The query stops as soon as the distance of the next
+ * primitive, which is a lower bound of its distance to the vertex, exceeds the distance of the
+ * closest valid projection found so far.
+ *
+ * @param[in] visitClosest visits the nnearest primitives, see query::Index::visitClosestTriangles()
+ * @param[out] weights the interpolation elements of the projection
+ * @param[out] distance the distance to the projected point
+ * @return true if a valid projection was found
+ */
+template <typename Primitives, typename Visit>
+bool projectOnClosest(const mesh::Vertex &vertex, const Primitives &primitives, Visit &visitClosest,
+                      query::InterpolationElements &weights, double &distance)
+{
+  bool found = false;
+  visitClosest(vertex, nnearest, [&](const auto &match) {
+    if (found && distance <= match.distance) {
+      return false;
+    }
+    auto elements = query::generateInterpolationElements(vertex, primitives[match.index]);
+    if (std::all_of(elements.begin(), elements.end(), [](query::InterpolationElement const &elem) { return elem.weight >= 0.0; })) {
+      mesh::Vertex::RawCoords projection = mesh::Vertex::RawCoords::Zero(vertex.getDimensions());
+      for (const auto &elem : elements) {
+        projection += elem.weight * elem.element->getCoords();
+      }
+      const double projectionDistance = (vertex.getCoords() - projection).norm();
+      if (not found || projectionDistance < distance) {
+        weights  = std::move(elements);
+        distance = projectionDistance;
+        found    = true;
+      }
+    }
+    return true;
+  });
+  return found;
+}
 } // namespace
 
 void NearestProjectionMapping::computeMapping()
@@ -74,103 +109,158 @@ void NearestProjectionMapping::computeMapping()
     search_space = output();
   }
 
-  const auto &fVertices = origins->vertices();
-  const auto &tVertices = search_space->vertices();
-  const auto &tEdges    = search_space->edges();
+  // Matching meshes reduce to a permutation, which requires neither an index tree nor the cache
+  std::vector<int> matchingVertices;
+  if (findMatchingVertices(matchingVertices)) {
+    _weights.assign(origins->vertices().size(), {});
+    for (size_t i = 0; i < matchingVertices.size(); i++) {
+      if (getConstraint() == CONSISTENT) {
+        _weights[i].emplace_back(input()->vertices()[matchingVertices[i]], 1.0);
+      } else {
+        _weights[matchingVertices[i]].emplace_back(output()->vertices()[i], 1.0);
+      }
+    }
+    computeInterpolationOperator();
+    _hasComputedMapping = true;
+    return;
+  }
 
-  _weights.resize(fVertices.size());
+  std::string cacheKey;
+  if (getCache()) {
+    cacheKey = MappingCache::computeKey(getConstraint() == CONSISTENT ? "nearest-projection-consistent" : "nearest-projection-conservative", *input(), *output());
+    if (loadFromCache(cacheKey, *origins, *search_space)) {
+      PRECICE_INFO("Loaded the mapping from the cache directory \"" << getCache()->getDirectory() << "\"");
+      computeInterpolationOperator();
+      _hasComputedMapping = true;
+      return;
+    }
+  }
 
-  // Amount of nearest elements to fetch for detailed comparison.
-  // This safety margin results in a candidate set which forms the base for the
-  // local nearest projection and counters the loss of detail due to bounding box generation.
-  // @TODO Add a configuration option for this factor
-  constexpr int nnearest = 4;
+  const auto &fVertices  = origins->vertices();
+  const auto &tVertices  = search_space->vertices();
+  const auto &tEdges     = search_space->edges();
+  const auto &tTriangles = search_space->triangles();
 
-  query::Index indexTree(search_space);
+  _weights.resize(fVertices.size());
 
   if (getDimensions() == 2) {
     if (!fVertices.empty() && tEdges.empty()) {
       PRECICE_WARN("2D Mesh \"" << search_space->getName() << "\" does not contain edges. Nearest projection mapping falls back to nearest neighbor mapping.");
     }
-
-    utils::statistics::DistanceAccumulator distanceStatistics;
-
-    for (size_t i = 0; i < fVertices.size(); i++) {
-      auto matchedEdges = indexTree.getClosestEdges(fVertices[i], nnearest);
-      bool found        = false;
-      for (const auto &match : matchedEdges) {
-        auto weights = query::generateInterpolationElements(fVertices[i], tEdges[match.index]);
-        if (std::all_of(weights.begin(), weights.end(), [](query::InterpolationElement const &elem) { return elem.weight >= 0.0; })) {
-          _weights[i] = std::move(weights);
-          distanceStatistics(match.distance);
-          found = true;
-          break;
-        }
-      }
-
-      if (not found) {
-        // Search for the origin inside the destination meshes vertices
-        auto matchedVertex = indexTree.getClosestVertex(fVertices[i]);
-        _weights[i]        = query::generateInterpolationElements(fVertices[i], tVertices[matchedVertex.index]);
-        distanceStatistics(matchedVertex.distance);
-      }
-    }
-    if (distanceStatistics.empty()) {
-      PRECICE_INFO("Mapping distance not available due to empty partition.");
-    } else {
-      PRECICE_INFO("Mapping distance " << distanceStatistics);
-    }
   } else {
-    const auto &tTriangles = search_space->triangles();
     if (!fVertices.empty() && tTriangles.empty()) {
       PRECICE_WARN("3D Mesh \"" << search_space->getName() << "\" does not contain triangles. Nearest projection mapping will map to primitives of lower dimension.");
     }
+  }
 
-    utils::statistics::DistanceAccumulator distanceStatistics;
-
-    for (size_t i = 0; i < fVertices.size(); i++) {
-      auto matchedTriangles = indexTree.getClosestTriangles(fVertices[i], nnearest);
-      bool found            = false;
-      for (const auto &match : matchedTriangles) {
-        auto weights = query::generateInterpolationElements(fVertices[i], tTriangles[match.index]);
-        if (std::all_of(weights.begin(), weights.end(), [](query::InterpolationElement const &elem) { return elem.weight >= 0.0; })) {
-          _weights[i] = std::move(weights);
-          found       = true;
-          distanceStatistics(match.distance);
-          break;
-        }
-      }
+  // The trees are created upfront, as the concurrent queries must not modify the index
+  query::Index indexTree(search_space);
+  indexTree.createIndexTrees();
+  auto visitTriangles = [&indexTree](const mesh::Vertex &vertex, int n, const query::Index::TriangleVisitor &visitor) {
+    indexTree.visitClosestTriangles(vertex, n, visitor);
+  };
+  auto visitEdges = [&indexTree](const mesh::Vertex &vertex, int n, const query::Index::EdgeVisitor &visitor) {
+    indexTree.visitClosestEdges(vertex, n, visitor);
+  };
 
+  utils::statistics::DistanceAccumulator distanceStatistics;
+  std::mutex                             statisticsMutex;
+  utils::parallelFor(fVertices.size(), minVerticesPerThread, [&](size_t begin, size_t end) {
+    utils::statistics::DistanceAccumulator localStatistics;
+    for (size_t i = begin; i < end; i++) {
+      double distance = 0.0;
+      bool   found    = getDimensions() == 3 && projectOnClosest(fVertices[i], tTriangles, visitTriangles, _weights[i], distance);
       if (not found) {
-        // Search for the vertex inside the destination meshes edges
-        auto matchedEdges = indexTree.getClosestEdges(fVertices[i], nnearest);
-        for (const auto &match : matchedEdges) {
-          auto weights = query::generateInterpolationElements(fVertices[i], tEdges[match.index]);
-          if (std::all_of(weights.begin(), weights.end(), [](query::InterpolationElement const &elem) { return elem.weight >= 0.0; })) {
-            _weights[i] = std::move(weights);
-            found       = true;
-            distanceStatistics(match.distance);
-            break;
-          }
-        }
+        found = projectOnClosest(fVertices[i], tEdges, visitEdges, _weights[i], distance);
       }
-
       if (not found) {
         // Search for the vertex inside the destination meshes vertices
         auto matchedVertex = indexTree.getClosestVertex(fVertices[i]);
         _weights[i]        = query::generateInterpolationElements(fVertices[i], tVertices[matchedVertex.index]);
-        distanceStatistics(matchedVertex.distance);
+        distance           = matchedVertex.distance;
       }
+      localStatistics(distance);
     }
-    if (distanceStatistics.empty()) {
-      PRECICE_INFO("Mapping distance not available due to empty partition.");
-    } else {
-      PRECICE_INFO("Mapping distance " << distanceStatistics);
-    }
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    distanceStatistics.merge(localStatistics);
+  });
+  if (distanceStatistics.empty()) {
+    PRECICE_INFO("Mapping distance not available due to empty partition.");
+  } else {
+    PRECICE_INFO("Mapping distance " << distanceStatistics);
+  }
+
+  if (getCache()) {
+    storeInCache(cacheKey);
   }
+  computeInterpolationOperator();
   _hasComputedMapping = true;
 }
 
+void NearestProjectionMapping::computeInterpolationOperator()
+{
+  PRECICE_TRACE();
+  const int inSize  = input()->vertices().size();
+  const int outSize = output()->vertices().size();
+
+  // The weights belong to the output vertices for consistent mappings and to the input vertices for conservative mappings
+  std::vector<SparseOperator::Triplet> entries;
+  for (size_t i = 0; i < _weights.size(); i++) {
+    for (const query::InterpolationElement &elem : _weights[i]) {
+      if (getConstraint() == CONSISTENT) {
+        entries.emplace_back(static_cast<int>(i), elem.element->getID(), elem.weight);
+      } else {
+        entries.emplace_back(elem.element->getID(), static_cast<int>(i), elem.weight);
+      }
+    }
+  }
+  setInterpolationOperator(SparseOperator(outSize, inSize, entries));
+}
+
+bool NearestProjectionMapping::loadFromCache(const std::string &key, const mesh::Mesh &origins, const mesh::Mesh &searchSpace)
+{
+  PRECICE_TRACE(key);
+  MappingCache::Entry entry;
+  if (not getCache()->load(key, *input(), *output(), entry)) {
+    return false;
+  }
+
+  // Validate the entry, as the weights reference vertices of the search space
+  const auto &offsets = entry.offsets;
+  const auto  rows    = origins.vertices().size();
+  const auto  columns = searchSpace.vertices().size();
+  if (offsets.size() != rows + 1 || offsets.front() != 0 || static_cast<size_t>(offsets.back()) != entry.indices.size() ||
+      entry.indices.size() != entry.weights.size() || not std::is_sorted(offsets.begin(), offsets.end()) ||
+      not std::all_of(entry.indices.begin(), entry.indices.end(), [columns](int index) { return index >= 0 && static_cast<size_t>(index) < columns; })) {
+    PRECICE_DEBUG("Discarding invalid cache entry " << key);
+    return false;
+  }
+
+  _weights.assign(rows, {});
+  for (size_t i = 0; i < rows; ++i) {
+    for (int j = offsets[i]; j < offsets[i + 1]; ++j) {
+      _weights[i].emplace_back(searchSpace.vertices()[entry.indices[j]], entry.weights[j]);
+    }
+  }
+  return true;
+}
+
+void NearestProjectionMapping::storeInCache(const std::string &key)
+{
+  PRECICE_TRACE(key);
+  MappingCache::Entry entry;
+  entry.offsets.reserve(_weights.size() + 1);
+  entry.offsets.push_back(0);
+  for (const InterpolationElements &elems : _weights) {
+    for (const query::InterpolationElement &elem : elems) {
+      entry.indices.push_back(elem.element->getID());
+      entry.weights.push_back(elem.weight);
+    }
+    entry.offsets.push_back(entry.indices.size());
+  }
+  getCache()->store(key, *input(), *output(), entry);
+}
+
 bool NearestProjectionMapping::hasComputedMapping() const
 {
   return _hasComputedMapping;
@@ -180,6 +270,7 @@ void NearestProjectionMapping::clear()
 {
   PRECICE_TRACE();
   _weights.clear();
+  setInterpolationOperator(SparseOperator());
   _hasComputedMapping = false;
 }
 
@@ -191,48 +282,13 @@ void NearestProjectionMapping::map(
 
   precice::utils::Event e("map.np.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
 
-  mesh::PtrData          inData    = input()->data(inputDataID);
-  mesh::PtrData          outData   = output()->data(outputDataID);
-  const Eigen::VectorXd &inValues  = inData->values();
-  Eigen::VectorXd &      outValues = outData->values();
-  //assign(outValues) = 0.0;
-  int dimensions = inData->getDimensions();
-  PRECICE_ASSERT(dimensions == outData->getDimensions());
+  PRECICE_ASSERT(_hasComputedMapping);
+  mapWithInterpolationOperator(inputDataID, outputDataID);
+}
 
-  if (getConstraint() == CONSISTENT) {
-    PRECICE_DEBUG("Map consistent");
-    PRECICE_ASSERT(_weights.size() == output()->vertices().size(),
-                   _weights.size(), output()->vertices().size());
-    for (size_t i = 0; i < output()->vertices().size(); i++) {
-      InterpolationElements &elems     = _weights[i];
-      size_t                 outOffset = i * dimensions;
-      for (query::InterpolationElement &elem : elems) {
-        size_t inOffset = (size_t) elem.element->getID() * dimensions;
-        for (int dim = 0; dim < dimensions; dim++) {
-          PRECICE_ASSERT(outOffset + dim < (size_t) outValues.size());
-          PRECICE_ASSERT(inOffset + dim < (size_t) inValues.size());
-          outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-        }
-      }
-    }
-  } else {
-    PRECICE_ASSERT(getConstraint() == CONSERVATIVE, getConstraint());
-    PRECICE_DEBUG("Map conservative");
-    PRECICE_ASSERT(_weights.size() == input()->vertices().size(),
-                   _weights.size(), input()->vertices().size());
-    for (size_t i = 0; i < input()->vertices().size(); i++) {
-      size_t                 inOffset = i * dimensions;
-      InterpolationElements &elems    = _weights[i];
-      for (query::InterpolationElement &elem : elems) {
-        size_t outOffset = (size_t) elem.element->getID() * dimensions;
-        for (int dim = 0; dim < dimensions; dim++) {
-          PRECICE_ASSERT(outOffset + dim < (size_t) outValues.size());
-          PRECICE_ASSERT(inOffset + dim < (size_t) inValues.size());
-          outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-        }
-      }
-    }
-  }
+bool NearestProjectionMapping::canMapConcurrently() const
+{
+  return true;
 }
 
 void NearestProjectionMapping::tagMeshFirstRound()
@@ -43,6 +43,9 @@ public:
       int inputDataID,
       int outputDataID) override;
 
+  /// Returns true, as map() only uses the precomputed mapping.
+  virtual bool canMapConcurrently() const override;
+
   virtual void tagMeshFirstRound() override;
   virtual void tagMeshSecondRound() override;
 
@@ -52,6 +55,15 @@ private:
   using InterpolationElements = std::vector<query::InterpolationElement>;
   std::vector<InterpolationElements> _weights;
 
+  /// Loads the weights from the cache, returns false if there is no valid entry for the given key
+  bool loadFromCache(const std::string &key, const mesh::Mesh &origins, const mesh::Mesh &searchSpace);
+
+  /// Stores the computed weights in the cache
+  void storeInCache(const std::string &key);
+
+  /// Sets the interpolation operator from _weights
+  void computeInterpolationOperator();
+
   bool _hasComputedMapping = false;
 };
 
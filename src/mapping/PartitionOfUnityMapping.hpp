@@ -0,0 +1,512 @@
+#pragma once
+
+#include "Mapping.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/QR>
+#include <Eigen/SparseCore>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <vector>
+
+#include "impl/BasisFunctions.hpp"
+#include "mesh/BoundingBox.hpp"
+#include "query/Index.hpp"
+#include "utils/Event.hpp"
+#include "utils/Threads.hpp"
+
+namespace precice {
+extern bool syncMode;
+
+namespace mapping {
+
+/**
+ * @brief Mapping with radial basis functions on overlapping local clusters.
+ *
+ * Instead of a single global interpolant, the interface is covered by overlapping
+ * spherical clusters, which are centered on a regular grid and contain roughly a given
+ * number of vertices of the mesh to interpolate from. A small radial basis function
+ * interpolant with a linear polynomial is constructed in every cluster independently,
+ * and the local interpolants are blended using partition-of-unity weights. Clusters whose
+ * vertices do not determine the polynomial, e.g. coplanar vertices of a surface in 3D or
+ * fewer vertices than polynomial coefficients, use an interpolant without polynomial.
+ *
+ * The local systems are solved in parallel using utils::parallelFor() and combined to a
+ * sparse mapping operator, which is applied in map(). Conservative mappings use the
+ * transposed operator of the corresponding consistent mapping.
+ *
+ * The radial basis function type has to be given as template parameter, and has
+ * to be one of the types defined in impl/BasisFunctions.hpp.
+ */
+template <typename RADIAL_BASIS_FUNCTION_T>
+class PartitionOfUnityMapping : public Mapping {
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] constraint Specifies mapping to be consistent or conservative.
+   * @param[in] dimensions Dimensionality of the meshes
+   * @param[in] function Radial basis function used for the local interpolants.
+   * @param[in] xDead, yDead, zDead Deactivates mapping along an axis
+   * @param[in] verticesPerCluster Targeted number of vertices per cluster
+   */
+  PartitionOfUnityMapping(
+      Constraint              constraint,
+      int                     dimensions,
+      RADIAL_BASIS_FUNCTION_T function,
+      bool                    xDead,
+      bool                    yDead,
+      bool                    zDead,
+      int                     verticesPerCluster);
+
+  /// Computes the mapping operator from the in- and output mesh.
+  virtual void computeMapping() override;
+
+  /// Returns true, if computeMapping() has been called.
+  virtual bool hasComputedMapping() const override;
+
+  /// Removes a computed mapping.
+  virtual void clear() override;
+
+  /// Maps input data to output data from input mesh to output mesh.
+  virtual void map(int inputDataID, int outputDataID) override;
+
+  /// Returns true, as map() only applies the local operator.
+  virtual bool canMapConcurrently() const override;
+
+  virtual void tagMeshFirstRound() override;
+
+  virtual void tagMeshSecondRound() override;
+
+private:
+  mutable logging::Logger _log{"mapping::PartitionOfUnityMapping"};
+
+  /// A spherical cluster of vertices
+  struct Cluster {
+    /// Center of the cluster
+    Eigen::VectorXd center;
+    /// Radius of the cluster, all vertices lie inside this radius
+    double radius;
+    /// IDs of the vertices to interpolate from
+    std::vector<int> sourceIDs;
+    /// IDs of the vertices to interpolate to
+    std::vector<int> targetIDs;
+    /// Partition-of-unity weights of the target vertices, normalized in computeMapping()
+    std::vector<double> weights;
+  };
+
+  bool _hasComputedMapping = false;
+
+  /// Radial basis function type used in interpolation.
+  RADIAL_BASIS_FUNCTION_T _basisFunction;
+
+  /// true if the mapping along some axis should be ignored
+  std::vector<bool> _deadAxis;
+
+  /// Targeted number of vertices to interpolate from in every cluster
+  int _verticesPerCluster;
+
+  /// Returns the mesh to interpolate from, which is the output mesh for conservative mappings
+  mesh::PtrMesh sourceMesh() const;
+
+  /// Returns the mesh to interpolate to, which is the input mesh for conservative mappings
+  mesh::PtrMesh targetMesh() const;
+
+  /// Returns the coordinates without dead axes
+  Eigen::VectorXd reduce(const Eigen::VectorXd &coords) const;
+
+  /// Returns the vertices of the indexed mesh within the radius around center, ignoring dead axes
+  std::vector<int> verticesInsideRadius(query::Index &index, const mesh::PtrMesh &mesh, const Eigen::VectorXd &center, double radius) const;
+
+  /**
+   * @brief Covers the target mesh with clusters of source vertices.
+   *
+   * The result only depends on the source vertices close to the target mesh. These are
+   * reported in usedSourceIDs, which allows to filter the source mesh beforehand.
+   *
+   * @param[out] usedSourceIDs source vertices the clusters depend on, may contain duplicates
+   */
+  std::vector<Cluster> computeClusters(std::vector<int> &usedSourceIDs) const;
+
+  /**
+   * @brief Solves the local interpolation problem of the cluster.
+   *
+   * @param[out] local the local operator, rows correspond to target vertices
+   * @return false if the local interpolation matrix is singular
+   */
+  bool computeLocalOperator(const Cluster &cluster, Eigen::MatrixXd &local) const;
+
+  void setDeadAxis(bool xDead, bool yDead, bool zDead)
+  {
+    _deadAxis.resize(getDimensions());
+    if (getDimensions() == 2) {
+      _deadAxis[0] = xDead;
+      _deadAxis[1] = yDead;
+      PRECICE_CHECK(not(xDead && yDead), "You cannot choose all axes to be dead for a RBF mapping");
+      if (zDead)
+        PRECICE_WARN("Setting the z-axis to dead on a 2-dimensional problem has no effect.");
+    } else if (getDimensions() == 3) {
+      _deadAxis[0] = xDead;
+      _deadAxis[1] = yDead;
+      _deadAxis[2] = zDead;
+      PRECICE_CHECK(not(xDead && yDead && zDead), "You cannot choose all axes to be dead for a RBF mapping");
+    } else {
+      PRECICE_ASSERT(false);
+    }
+  }
+};
+
+// --------------------------------------------------- HEADER IMPLEMENTATIONS
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::PartitionOfUnityMapping(
+    Constraint              constraint,
+    int                     dimensions,
+    RADIAL_BASIS_FUNCTION_T function,
+    bool                    xDead,
+    bool                    yDead,
+    bool                    zDead,
+    int                     verticesPerCluster)
+    : Mapping(constraint, dimensions),
+      _basisFunction(function),
+      _verticesPerCluster(verticesPerCluster)
+{
+  PRECICE_CHECK(verticesPerCluster > 1,
+                "The number of vertices per cluster of a partition-of-unity mapping has to be larger than one. Please update the \"vertices-per-cluster\" attribute.");
+  setInputRequirement(Mapping::MeshRequirement::VERTEX);
+  setOutputRequirement(Mapping::MeshRequirement::VERTEX);
+  setDeadAxis(xDead, yDead, zDead);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
+{
+  PRECICE_TRACE();
+
+  precice::utils::Event e("map.pou.computeMapping.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  PRECICE_ASSERT(input()->getDimensions() == output()->getDimensions(),
+                 input()->getDimensions(), output()->getDimensions());
+
+  // The local interpolants reproduce the values at their centers, hence matching meshes reduce to a permutation
+  std::vector<int> matchingVertices;
+  if (findMatchingVertices(matchingVertices)) {
+    setPermutationOperator(matchingVertices);
+    _hasComputedMapping = true;
+    return;
+  }
+
+  std::vector<int>     usedSourceIDs;
+  std::vector<Cluster> clusters = computeClusters(usedSourceIDs);
+  PRECICE_DEBUG("Covered mesh " << targetMesh()->getName() << " by " << clusters.size() << " clusters");
+
+  // Normalize the weights, summing up in a fixed order keeps the result independent of the threads
+  std::vector<double> weightSums(targetMesh()->vertices().size(), 0.0);
+  for (const Cluster &cluster : clusters) {
+    for (size_t i = 0; i < cluster.targetIDs.size(); ++i) {
+      weightSums[cluster.targetIDs[i]] += cluster.weights[i];
+    }
+  }
+  for (Cluster &cluster : clusters) {
+    for (size_t i = 0; i < cluster.targetIDs.size(); ++i) {
+      cluster.weights[i] /= weightSums[cluster.targetIDs[i]];
+    }
+  }
+
+  // Solve the independent local problems, failures are reported after all threads finished
+  std::vector<std::vector<Eigen::Triplet<double>>> entries(clusters.size());
+  std::vector<char>                                isInvertible(clusters.size(), true);
+  utils::parallelFor(clusters.size(), 1, [&](size_t begin, size_t end) {
+    for (size_t c = begin; c < end; ++c) {
+      const Cluster & cluster = clusters[c];
+      Eigen::MatrixXd local;
+      isInvertible[c] = computeLocalOperator(cluster, local);
+      if (not isInvertible[c]) {
+        continue;
+      }
+      entries[c].reserve(local.size());
+      for (size_t i = 0; i < cluster.targetIDs.size(); ++i) {
+        for (size_t j = 0; j < cluster.sourceIDs.size(); ++j) {
+          entries[c].emplace_back(cluster.targetIDs[i], cluster.sourceIDs[j], cluster.weights[i] * local(i, j));
+        }
+      }
+    }
+  });
+
+  if (std::find(isInvertible.begin(), isInvertible.end(), false) != isInvertible.end()) {
+    PRECICE_ERROR("The interpolation matrix of the RBF mapping from mesh " << input()->getName() << " to mesh "
+                                                                           << output()->getName() << " is not invertable in some cluster. This means that the mapping problem is not well-posed. "
+                                                                           << "Please check if your coupling meshes are correct. Maybe you need to fix axis-aligned mapping setups "
+                                                                           << "by marking perpendicular axes as dead?");
+  }
+
+  // Conservative mappings distribute the values of the target mesh to the source mesh, which is the transposed operator
+  std::vector<SparseOperator::Triplet> allEntries;
+  for (auto &clusterEntries : entries) {
+    for (const auto &entry : clusterEntries) {
+      if (getConstraint() == CONSISTENT) {
+        allEntries.emplace_back(entry.row(), entry.col(), entry.value());
+      } else {
+        allEntries.emplace_back(entry.col(), entry.row(), entry.value());
+      }
+    }
+  }
+  setInterpolationOperator(SparseOperator(output()->vertices().size(), input()->vertices().size(), allEntries));
+
+  _hasComputedMapping = true;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::hasComputedMapping() const
+{
+  return _hasComputedMapping;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::clear()
+{
+  PRECICE_TRACE();
+  setInterpolationOperator(SparseOperator());
+  _hasComputedMapping = false;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::map(
+    int inputDataID,
+    int outputDataID)
+{
+  PRECICE_TRACE(inputDataID, outputDataID);
+
+  precice::utils::Event e("map.pou.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  PRECICE_ASSERT(_hasComputedMapping);
+  mapWithInterpolationOperator(inputDataID, outputDataID);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::canMapConcurrently() const
+{
+  return true;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshFirstRound()
+{
+  PRECICE_TRACE();
+
+  if (targetMesh()->vertices().empty())
+    return; // Ranks not at the interface should never hold interface vertices
+
+  // Tags all vertices the clusters covering the local mesh depend on
+  std::vector<int> usedSourceIDs;
+  computeClusters(usedSourceIDs);
+  for (int id : usedSourceIDs) {
+    sourceMesh()->vertices()[id].tag();
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshSecondRound()
+{
+  PRECICE_TRACE();
+  // The clusters do not depend on the ownership of vertices
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+mesh::PtrMesh PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::sourceMesh() const
+{
+  return getConstraint() == CONSISTENT ? input() : output();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+mesh::PtrMesh PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::targetMesh() const
+{
+  return getConstraint() == CONSISTENT ? output() : input();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::reduce(const Eigen::VectorXd &coords) const
+{
+  Eigen::VectorXd reduced(coords.size());
+  int             k = 0;
+  for (int d = 0; d < coords.size(); ++d) {
+    if (not _deadAxis[d]) {
+      reduced[k++] = coords[d];
+    }
+  }
+  reduced.conservativeResize(k);
+  return reduced;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+std::vector<int> PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::verticesInsideRadius(
+    query::Index &index, const mesh::PtrMesh &mesh, const Eigen::VectorXd &center, double radius) const
+{
+  std::vector<double> bounds;
+  for (int d = 0; d < center.size(); d++) {
+    if (_deadAxis[d]) {
+      bounds.push_back(std::numeric_limits<double>::lowest());
+      bounds.push_back(std::numeric_limits<double>::max());
+    } else {
+      bounds.push_back(center[d] - radius);
+      bounds.push_back(center[d] + radius);
+    }
+  }
+  const Eigen::VectorXd reducedCenter = reduce(center);
+
+  std::vector<int> inside;
+  for (size_t id : index.getVerticesInsideBox(mesh::BoundingBox(std::move(bounds)))) {
+    if ((reduce(mesh->vertices()[id].getCoords()) - reducedCenter).norm() <= radius) {
+      inside.push_back(id);
+    }
+  }
+  // The order of the index tree is arbitrary
+  std::sort(inside.begin(), inside.end());
+  return inside;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+std::vector<typename PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::Cluster>
+PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeClusters(std::vector<int> &usedSourceIDs) const
+{
+  PRECICE_TRACE();
+  const mesh::PtrMesh source = sourceMesh();
+  const mesh::PtrMesh target = targetMesh();
+  const int           nearestCount = std::min(_verticesPerCluster, static_cast<int>(source->vertices().size()));
+
+  std::vector<Cluster> clusters;
+  if (nearestCount == 0 || target->vertices().empty()) {
+    return clusters;
+  }
+
+  query::Index sourceIndex(source);
+  query::Index targetIndex(target);
+
+  // Estimate the cluster radius from the distance of a sample of target vertices to their nearest source vertices
+  const size_t sampleStride = std::max<size_t>(1, target->vertices().size() / 100);
+  double       radius       = 0.0;
+  int          sampleCount  = 0;
+  for (size_t i = 0; i < target->vertices().size(); i += sampleStride) {
+    const auto matches = sourceIndex.getClosestVertices(target->vertices()[i], nearestCount);
+    radius += matches.back().distance;
+    ++sampleCount;
+    for (const auto &match : matches) {
+      usedSourceIDs.push_back(match.index);
+    }
+  }
+  radius /= sampleCount;
+  if (radius <= 0.0) {
+    radius = 1.0; // All source vertices coincide, any length scale works
+  }
+
+  // Place the cluster centers on a grid with a spacing of the cluster radius, such that every
+  // target vertex lies well inside the cluster of its grid cell.
+  const double                       spacing = radius;
+  std::map<std::array<long, 3>, int> cells;
+  for (const mesh::Vertex &vertex : target->vertices()) {
+    const auto &        coords = vertex.getCoords();
+    std::array<long, 3> key{0, 0, 0};
+    for (int d = 0; d < coords.size(); ++d) {
+      if (not _deadAxis[d]) {
+        key[d] = static_cast<long>(std::floor(coords[d] / spacing));
+      }
+    }
+    if (cells.count(key) == 0) {
+      Cluster cluster;
+      cluster.center = coords;
+      for (int d = 0; d < coords.size(); ++d) {
+        if (not _deadAxis[d]) {
+          cluster.center[d] = (key[d] + 0.5) * spacing;
+        }
+      }
+      cells.emplace(key, static_cast<int>(clusters.size()));
+      clusters.push_back(std::move(cluster));
+    }
+  }
+
+  // Enlarge clusters in sparse regions, such that they contain enough source vertices
+  for (Cluster &cluster : clusters) {
+    const mesh::Vertex center(cluster.center, -1);
+    const auto         matches = sourceIndex.getClosestVertices(center, nearestCount);
+    cluster.radius             = std::max(radius, matches.back().distance);
+    cluster.sourceIDs          = verticesInsideRadius(sourceIndex, source, cluster.center, cluster.radius);
+    usedSourceIDs.insert(usedSourceIDs.end(), cluster.sourceIDs.begin(), cluster.sourceIDs.end());
+
+    // Wendland C2 function as weight, which vanishes at the cluster boundary
+    const Eigen::VectorXd reducedCenter = reduce(cluster.center);
+    for (int id : verticesInsideRadius(targetIndex, target, cluster.center, cluster.radius)) {
+      const double r = (reduce(target->vertices()[id].getCoords()) - reducedCenter).norm() / cluster.radius;
+      if (r < 1.0) {
+        cluster.targetIDs.push_back(id);
+        cluster.weights.push_back(std::pow(1.0 - r, 4.0) * (4.0 * r + 1.0));
+      }
+    }
+  }
+  return clusters;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeLocalOperator(const Cluster &cluster, Eigen::MatrixXd &local) const
+{
+  const mesh::PtrMesh source = sourceMesh();
+  const mesh::PtrMesh target = targetMesh();
+
+  const int sourceSize = cluster.sourceIDs.size();
+  const int targetSize = cluster.targetIDs.size();
+
+  // Coordinates relative to the cluster center improve the conditioning of the polynomial
+  const Eigen::VectorXd reducedCenter = reduce(cluster.center);
+  Eigen::MatrixXd       sourceCoords(reducedCenter.size(), sourceSize);
+  for (int j = 0; j < sourceSize; ++j) {
+    sourceCoords.col(j) = reduce(source->vertices()[cluster.sourceIDs[j]].getCoords()) - reducedCenter;
+  }
+  Eigen::MatrixXd targetCoords(reducedCenter.size(), targetSize);
+  for (int i = 0; i < targetSize; ++i) {
+    targetCoords.col(i) = reduce(target->vertices()[cluster.targetIDs[i]].getCoords()) - reducedCenter;
+  }
+
+  // The polynomial is dropped if the source vertices do not determine it
+  for (int polyparams : {1 + static_cast<int>(reducedCenter.size()), 0}) {
+    const int n = sourceSize + polyparams; // Add linear polynom degrees
+
+    Eigen::MatrixXd matrixCLU = Eigen::MatrixXd::Zero(n, n);
+    for (int i = 0; i < sourceSize; ++i) {
+      for (int j = i; j < sourceSize; ++j) {
+        matrixCLU(i, j) = _basisFunction.evaluate((sourceCoords.col(i) - sourceCoords.col(j)).norm());
+      }
+      if (polyparams > 0) {
+        matrixCLU(i, sourceSize) = 1.0;
+        matrixCLU.block(i, sourceSize + 1, 1, polyparams - 1) = sourceCoords.col(i).transpose();
+      }
+    }
+    matrixCLU.triangularView<Eigen::StrictlyLower>() = matrixCLU.transpose();
+
+    const auto qr = matrixCLU.colPivHouseholderQr();
+    if (not qr.isInvertible()) {
+      continue;
+    }
+
+    Eigen::MatrixXd matrixA(targetSize, n);
+    for (int i = 0; i < targetSize; ++i) {
+      for (int j = 0; j < sourceSize; ++j) {
+        matrixA(i, j) = _basisFunction.evaluate((targetCoords.col(i) - sourceCoords.col(j)).norm());
+      }
+      if (polyparams > 0) {
+        matrixA(i, sourceSize) = 1.0;
+        matrixA.block(i, sourceSize + 1, 1, polyparams - 1) = targetCoords.col(i).transpose();
+      }
+    }
+
+    // The interpolation matrix is symmetric, hence (A * C^-1)^T = C^-1 * A^T
+    const Eigen::MatrixXd solution = qr.solve(matrixA.transpose());
+    local                          = solution.topRows(sourceSize).transpose();
+    return true;
+  }
+  return false;
+}
+
+} // namespace mapping
+} // namespace precice
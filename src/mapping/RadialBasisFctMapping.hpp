@@ -4,21 +4,32 @@
 
 #include <Eigen/Core>
 #include <Eigen/QR>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <vector>
 
-#include "com/CommunicateMesh.hpp"
-#include "com/Communication.hpp"
 #include "impl/BasisFunctions.hpp"
 #include "mesh/Filter.hpp"
 #include "query/Index.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/Event.hpp"
 #include "utils/MasterSlave.hpp"
+#include "utils/Threads.hpp"
 
 namespace precice {
 extern bool syncMode;
 
 namespace mapping {
 
+inline Eigen::MatrixXd reducedCoordinates(const mesh::Mesh &mesh, const std::vector<bool> &deadAxis);
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+class MatrixFreeEvaluation;
+
 /**
  * @brief Mapping with radial basis functions.
  *
@@ -29,6 +40,18 @@ namespace mapping {
  *
  * The radial basis function type has to be given as template parameter, and has
  * to be one of the defined types in this file.
+ *
+ * In parallel, every rank assembles the global input mesh from the owned vertices of all ranks
+ * and factorizes the interpolation system itself. The input data and the conservative
+ * contributions are summed up by allreduce operations, hence no rank waits for the master to
+ * solve and every rank evaluates the interpolant at its own vertices.
+ *
+ * For basis functions with compact support, the matrices are assembled as sparse matrices
+ * from the vertices within the support radius and the system is solved with a sparse LU.
+ *
+ * For basis functions with global support, the dense evaluation matrix is only stored if it
+ * fits into the given memory limit. Otherwise, its entries are recomputed during every mapping,
+ * see MatrixFreeEvaluation.
  */
 template <typename RADIAL_BASIS_FUNCTION_T>
 class RadialBasisFctMapping : public Mapping {
@@ -40,6 +63,7 @@ public:
    * @param[in] dimensions Dimensionality of the meshes
    * @param[in] function Radial basis function used for mapping.
    * @param[in] xDead, yDead, zDead Deactivates mapping along an axis
+   * @param[in] evaluationMemoryLimit Memory in megabytes the evaluation matrix may occupy, negative for no limit
    */
   RadialBasisFctMapping(
       Constraint              constraint,
@@ -47,7 +71,8 @@ public:
       RADIAL_BASIS_FUNCTION_T function,
       bool                    xDead,
       bool                    yDead,
-      bool                    zDead);
+      bool                    zDead,
+      double                  evaluationMemoryLimit = -1.0);
 
   /// Computes the mapping coefficients from the in- and output mesh.
   virtual void computeMapping() override;
@@ -61,6 +86,12 @@ public:
   /// Maps input data to output data from input mesh to output mesh.
   virtual void map(int inputDataID, int outputDataID) override;
 
+  /// Maps all components of all given data fields as a single right-hand side.
+  virtual void mapBatch(const DataIDPairs &dataIDs) override;
+
+  /// Returns true for serial participants, as the mapping communicates with the master otherwise.
+  virtual bool canMapConcurrently() const override;
+
   virtual void tagMeshFirstRound() override;
 
   virtual void tagMeshSecondRound() override;
@@ -73,15 +104,54 @@ private:
   /// Radial basis function type used in interpolation.
   RADIAL_BASIS_FUNCTION_T _basisFunction;
 
+  using SparseMatrix = Eigen::SparseMatrix<double>;
+  using SparseLU     = Eigen::SparseLU<SparseMatrix, Eigen::COLAMDOrdering<int>>;
+
+  /// Evaluation matrix for basis functions with global support
   Eigen::MatrixXd _matrixA;
 
+  /// Memory in megabytes _matrixA may occupy, negative for no limit
+  double _evaluationMemoryLimit;
+
+  /// true if _matrixA exceeds the memory limit and is recomputed during every mapping
+  bool _matrixFree = false;
+
+  /// Reduced coordinates of the global input and the local output vertices, only used if _matrixFree
+  Eigen::MatrixXd _inCoordinates;
+  Eigen::MatrixXd _outCoordinates;
+
+  /// Evaluation matrix for basis functions with compact support
+  SparseMatrix _sparseMatrixA;
+
+  /// Factorized interpolation system for basis functions with global support
   Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _qr;
 
+  /// Factorized interpolation system for basis functions with compact support
+  std::unique_ptr<SparseLU> _sparseLU;
+
+  /// Offset of the owned input vertices of this rank in the global input mesh
+  int _globalInOffset = 0;
+
   /// true if the mapping along some axis should be ignored
   std::vector<bool> _deadAxis;
 
-  void mapConservative(int inputDataID, int outputDataID, int polyparams);
-  void mapConsistent(int inputDataID, int outputDataID, int polyparams);
+  template <typename MATRIX_T>
+  void mapConservative(const MATRIX_T &matrixA, const DataIDPairs &dataIDs, const std::vector<int> &offsets, int polyparams);
+
+  template <typename MATRIX_T>
+  void mapConsistent(const MATRIX_T &matrixA, const DataIDPairs &dataIDs, const std::vector<int> &offsets, int polyparams);
+
+  /// Solves the interpolation system for all columns of the right-hand side at once
+  Eigen::MatrixXd solveSystem(const Eigen::MatrixXd &rhs);
+
+  /**
+   * @brief Stacks the input data of several data fields.
+   *
+   * @param[in] offsets first column of each data field, followed by the total number of columns
+   * @param[in] ownedOnly only use the data of owned vertices
+   * @return matrix with one row per vertex and one column per data component
+   */
+  Eigen::MatrixXd stackInputData(const DataIDPairs &dataIDs, const std::vector<int> &offsets, bool ownedOnly) const;
 
   void setDeadAxis(bool xDead, bool yDead, bool zDead)
   {
@@ -112,9 +182,11 @@ RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctMapping(
     RADIAL_BASIS_FUNCTION_T function,
     bool                    xDead,
     bool                    yDead,
-    bool                    zDead)
+    bool                    zDead,
+    double                  evaluationMemoryLimit)
     : Mapping(constraint, dimensions),
-      _basisFunction(function)
+      _basisFunction(function),
+      _evaluationMemoryLimit(evaluationMemoryLimit)
 {
   setInputRequirement(Mapping::MeshRequirement::VERTEX);
   setOutputRequirement(Mapping::MeshRequirement::VERTEX);
@@ -144,56 +216,82 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     outMesh = output();
   }
 
-  if (utils::MasterSlave::isSlave()) {
-
-    // Input mesh may have overlaps
-    mesh::Mesh filteredInMesh("filteredInMesh", inMesh->getDimensions(), inMesh->isFlipNormals(), mesh::Mesh::MESH_ID_UNDEFINED);
-    mesh::filterMesh(filteredInMesh, *inMesh, [&](const mesh::Vertex &v) { return v.isOwner(); });
-
-    // Send the mesh
-    com::CommunicateMesh(utils::MasterSlave::_communication).sendMesh(filteredInMesh, 0);
-    com::CommunicateMesh(utils::MasterSlave::_communication).sendMesh(*outMesh, 0);
-
-  } else { // Parallel Master or Serial
-
-    mesh::Mesh globalInMesh("globalInMesh", inMesh->getDimensions(), inMesh->isFlipNormals(), mesh::Mesh::MESH_ID_UNDEFINED);
-    mesh::Mesh globalOutMesh("globalOutMesh", outMesh->getDimensions(), outMesh->isFlipNormals(), mesh::Mesh::MESH_ID_UNDEFINED);
-
-    if (utils::MasterSlave::isMaster()) {
-      {
-        // Input mesh may have overlaps
-        mesh::Mesh filteredInMesh("filteredInMesh", inMesh->getDimensions(), inMesh->isFlipNormals(), mesh::Mesh::MESH_ID_UNDEFINED);
-        mesh::filterMesh(filteredInMesh, *inMesh, [&](const mesh::Vertex &v) { return v.isOwner(); });
-        globalInMesh.addMesh(filteredInMesh);
-        globalOutMesh.addMesh(*outMesh);
-      }
+  // The interpolant reproduces the values at its centers, hence matching meshes reduce to a permutation.
+  // In parallel, the interpolant depends on the global input mesh and is always computed.
+  std::vector<int> matchingVertices;
+  if (not utils::MasterSlave::isMaster() && not utils::MasterSlave::isSlave() && findMatchingVertices(matchingVertices)) {
+    setPermutationOperator(matchingVertices);
+    _hasComputedMapping = true;
+    return;
+  }
 
-      // Receive mesh
-      for (int rankSlave = 1; rankSlave < utils::MasterSlave::getSize(); ++rankSlave) {
-        mesh::Mesh slaveInMesh(inMesh->getName(), inMesh->getDimensions(), inMesh->isFlipNormals(), mesh::Mesh::MESH_ID_UNDEFINED);
-        com::CommunicateMesh(utils::MasterSlave::_communication).receiveMesh(slaveInMesh, rankSlave);
-        globalInMesh.addMesh(slaveInMesh);
+  // Every rank needs the global input mesh to evaluate the interpolant at its output vertices
+  mesh::PtrMesh globalInMesh(new mesh::Mesh("globalInMesh", inMesh->getDimensions(), inMesh->isFlipNormals(), mesh::Mesh::MESH_ID_UNDEFINED));
+  _globalInOffset = 0;
 
-        mesh::Mesh slaveOutMesh(outMesh->getName(), outMesh->getDimensions(), outMesh->isFlipNormals(), mesh::Mesh::MESH_ID_UNDEFINED);
-        com::CommunicateMesh(utils::MasterSlave::_communication).receiveMesh(slaveOutMesh, rankSlave);
-        globalOutMesh.addMesh(slaveOutMesh);
-      }
+  if (utils::MasterSlave::isMaster() || utils::MasterSlave::isSlave()) {
+    // Input mesh may have overlaps
+    mesh::Mesh ownedInMesh("ownedInMesh", inMesh->getDimensions(), inMesh->isFlipNormals(), mesh::Mesh::MESH_ID_UNDEFINED);
+    mesh::filterMesh(ownedInMesh, *inMesh, [&](const mesh::Vertex &v) { return v.isOwner(); });
+
+    // The owned vertices of all ranks are concatenated in the order of the ranks
+    const int        rank = utils::MasterSlave::getRank();
+    const int        size = utils::MasterSlave::getSize();
+    std::vector<int> localCounts(size, 0), counts(size, 0);
+    localCounts[rank] = ownedInMesh.vertices().size();
+    utils::MasterSlave::allreduceSum(localCounts.data(), counts.data(), size);
+    _globalInOffset        = std::accumulate(counts.begin(), counts.begin() + rank, 0);
+    const int globalInSize = std::accumulate(counts.begin(), counts.end(), 0);
+
+    Eigen::MatrixXd localCoordinates = Eigen::MatrixXd::Zero(inMesh->getDimensions(), globalInSize);
+    for (size_t i = 0; i < ownedInMesh.vertices().size(); ++i) {
+      localCoordinates.col(_globalInOffset + i) = ownedInMesh.vertices()[i].getCoords();
+    }
+    Eigen::MatrixXd coordinates(localCoordinates.rows(), localCoordinates.cols());
+    utils::MasterSlave::allreduceSum(localCoordinates.data(), coordinates.data(), coordinates.size());
+    for (int i = 0; i < globalInSize; ++i) {
+      globalInMesh->createVertex(Eigen::VectorXd(coordinates.col(i)));
+    }
+  } else {
+    globalInMesh->addMesh(*inMesh);
+  }
 
-    } else { // Serial
-      globalInMesh.addMesh(*inMesh);
-      globalOutMesh.addMesh(*outMesh);
+  if (_basisFunction.hasCompactSupport()) {
+    _sparseMatrixA = buildSparseMatrixA(_basisFunction, globalInMesh, *outMesh, _deadAxis);
+  } else {
+    const int    reducedDimensions = std::count(_deadAxis.begin(), _deadAxis.end(), false);
+    const double matrixSize        = static_cast<double>(outMesh->vertices().size()) * (globalInMesh->vertices().size() + 1 + reducedDimensions) * sizeof(double) / 1e6;
+    _matrixFree                    = _evaluationMemoryLimit >= 0.0 && matrixSize > _evaluationMemoryLimit;
+    if (_matrixFree) {
+      PRECICE_DEBUG("Evaluation matrix of " << matrixSize << " MB exceeds the limit of " << _evaluationMemoryLimit << " MB and is recomputed during every mapping.");
+      _inCoordinates  = reducedCoordinates(*globalInMesh, _deadAxis);
+      _outCoordinates = reducedCoordinates(*outMesh, _deadAxis);
+    } else {
+      _matrixA = buildMatrixA(_basisFunction, *globalInMesh, *outMesh, _deadAxis);
     }
+  }
 
-    _matrixA = buildMatrixA(_basisFunction, globalInMesh, globalOutMesh, _deadAxis);
-    _qr      = buildMatrixCLU(_basisFunction, globalInMesh, _deadAxis).colPivHouseholderQr();
+  // Every rank factorizes the same global system, which replaces solving on the master and broadcasting the solution
+  bool isInvertible;
+  if (_basisFunction.hasCompactSupport()) {
+    _sparseLU = std::make_unique<SparseLU>();
+    _sparseLU->compute(buildSparseMatrixCLU(_basisFunction, globalInMesh, _deadAxis));
+    isInvertible = _sparseLU->info() == Eigen::Success;
+  } else {
+    _qr          = buildMatrixCLU(_basisFunction, *globalInMesh, _deadAxis).colPivHouseholderQr();
+    isInvertible = _qr.isInvertible();
+  }
 
-    if (not _qr.isInvertible()) {
-      PRECICE_ERROR("The interpolation matrix of the RBF mapping from mesh " << input()->getName() << " to mesh "
-                                                                             << output()->getName() << " is not invertable. This means that the mapping problem is not well-posed. "
-                                                                             << "Please check if your coupling meshes are correct. Maybe you need to fix axis-aligned mapping setups "
-                                                                             << "by marking perpendicular axes as dead?");
-    }
+  if (not isInvertible) {
+    PRECICE_ERROR("The interpolation matrix of the RBF mapping from mesh " << input()->getName() << " to mesh "
+                                                                           << output()->getName() << " is not invertable. This means that the mapping problem is not well-posed. "
+                                                                           << "Please check if your coupling meshes are correct. Maybe you need to fix axis-aligned mapping setups "
+                                                                           << "by marking perpendicular axes as dead?");
   }
+
+  // The index tree of the temporary global mesh is not needed anymore
+  query::clearCache(*globalInMesh);
+
   _hasComputedMapping = true;
   PRECICE_DEBUG("Compute Mapping is Completed.");
 }
@@ -209,7 +307,14 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::clear()
 {
   PRECICE_TRACE();
   _matrixA            = Eigen::MatrixXd();
+  _inCoordinates      = Eigen::MatrixXd();
+  _outCoordinates     = Eigen::MatrixXd();
+  _matrixFree         = false;
+  _sparseMatrixA      = SparseMatrix();
   _qr                 = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+  _sparseLU.reset();
+  _globalInOffset     = 0;
+  setInterpolationOperator(SparseOperator());
   _hasComputedMapping = false;
 }
 
@@ -219,6 +324,13 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(
     int outputDataID)
 {
   PRECICE_TRACE(inputDataID, outputDataID);
+  mapBatch({{inputDataID, outputDataID}});
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapBatch(const DataIDPairs &dataIDs)
+{
+  PRECICE_TRACE(dataIDs.size());
 
   precice::utils::Event e("map.rbf.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
 
@@ -227,11 +339,25 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(
                  input()->getDimensions(), output()->getDimensions());
   PRECICE_ASSERT(getDimensions() == output()->getDimensions(),
                  getDimensions(), output()->getDimensions());
-  {
-    int valueDim = input()->data(inputDataID)->getDimensions();
-    PRECICE_ASSERT(valueDim == output()->data(outputDataID)->getDimensions(),
-                   valueDim, output()->data(outputDataID)->getDimensions());
+
+  if (not getInterpolationOperator().empty()) {
+    for (const auto &ids : dataIDs) {
+      mapWithInterpolationOperator(ids.first, ids.second);
+    }
+    return;
   }
+
+  // Every component of every data field forms a column of the right-hand side
+  std::vector<int> offsets{0};
+  for (const auto &ids : dataIDs) {
+    int valueDim = input()->data(ids.first)->getDimensions();
+    PRECICE_ASSERT(valueDim == output()->data(ids.second)->getDimensions(),
+                   valueDim, output()->data(ids.second)->getDimensions());
+    offsets.push_back(offsets.back() + valueDim);
+  }
+  if (dataIDs.empty())
+    return;
+
   int deadDimensions = 0;
   for (int d = 0; d < getDimensions(); d++) {
     if (_deadAxis[d])
@@ -239,231 +365,125 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(
   }
   int polyparams = 1 + getDimensions() - deadDimensions;
 
-  if (getConstraint() == CONSERVATIVE) {
-    mapConservative(inputDataID, outputDataID, polyparams);
+  if (_basisFunction.hasCompactSupport()) {
+    if (getConstraint() == CONSERVATIVE) {
+      mapConservative(_sparseMatrixA, dataIDs, offsets, polyparams);
+    } else if (getConstraint() == CONSISTENT) {
+      mapConsistent(_sparseMatrixA, dataIDs, offsets, polyparams);
+    }
+  } else if (_matrixFree) {
+    const MatrixFreeEvaluation<RADIAL_BASIS_FUNCTION_T> matrixA(_basisFunction, _inCoordinates, _outCoordinates);
+    if (getConstraint() == CONSERVATIVE) {
+      mapConservative(matrixA, dataIDs, offsets, polyparams);
+    } else if (getConstraint() == CONSISTENT) {
+      mapConsistent(matrixA, dataIDs, offsets, polyparams);
+    }
+  } else if (getConstraint() == CONSERVATIVE) {
+    mapConservative(_matrixA, dataIDs, offsets, polyparams);
   } else if (getConstraint() == CONSISTENT) {
-    mapConsistent(inputDataID, outputDataID, polyparams);
+    mapConsistent(_matrixA, dataIDs, offsets, polyparams);
   }
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConservative(int inputDataID, int outputDataID, int polyparams)
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::solveSystem(const Eigen::MatrixXd &rhs)
 {
+  PRECICE_TRACE(rhs.cols());
+  if (_basisFunction.hasCompactSupport()) {
+    return _sparseLU->solve(rhs);
+  }
+  return _qr.solve(rhs);
+}
 
-  PRECICE_TRACE(inputDataID, outputDataID, polyparams);
-
-  // Gather input data
-  if (utils::MasterSlave::isSlave()) {
-
-    const auto &localInData = input()->data(inputDataID)->values();
-
-    int localOutputSize = 0;
-    for (const auto &vertex : output()->vertices()) {
-      if (vertex.isOwner()) {
-        ++localOutputSize;
-      }
-    }
-
-    localOutputSize *= output()->data(outputDataID)->getDimensions();
-
-    utils::MasterSlave::_communication->send(localInData.data(), localInData.size(), 0);
-    utils::MasterSlave::_communication->send(localOutputSize, 0);
-
-  } else { // Parallel Master or Serial case
-
-    std::vector<double> globalInValues;
-    std::vector<double> outputValueSizes;
-    {
-      const auto &localInData = input()->data(inputDataID)->values();
-      globalInValues.insert(globalInValues.begin(), localInData.data(), localInData.data() + localInData.size());
-
-      int localOutputSize = 0;
-      for (const auto &vertex : output()->vertices()) {
-        if (vertex.isOwner()) {
-          ++localOutputSize;
-        }
-      }
-
-      localOutputSize *= output()->data(outputDataID)->getDimensions();
-
-      outputValueSizes.push_back(localOutputSize);
-    }
-
-    {
-      std::vector<double> slaveBuffer;
-      int                 slaveOutputValueSize;
-      for (int rank = 1; rank < utils::MasterSlave::getSize(); ++rank) {
-        utils::MasterSlave::_communication->receive(slaveBuffer, rank);
-        globalInValues.insert(globalInValues.end(), slaveBuffer.begin(), slaveBuffer.end());
-
-        utils::MasterSlave::_communication->receive(slaveOutputValueSize, rank);
-        outputValueSizes.push_back(slaveOutputValueSize);
-      }
-    }
-
-    int valueDim = output()->data(outputDataID)->getDimensions();
-
-    // Construct Eigen vectors
-    Eigen::Map<Eigen::VectorXd> inputValues(globalInValues.data(), globalInValues.size());
-    Eigen::VectorXd             outputValues((_matrixA.cols() - polyparams) * valueDim);
-    outputValues.setZero();
-
-    Eigen::VectorXd Au(_matrixA.cols());  // rows == n
-    Eigen::VectorXd in(_matrixA.rows());  // rows == outputSize
-    Eigen::VectorXd out(_matrixA.cols()); // rows == n
-
-    for (int dim = 0; dim < valueDim; dim++) {
-      for (int i = 0; i < in.size(); i++) { // Fill input data values
-        in[i] = inputValues(i * valueDim + dim);
-      }
-
-      Au  = _matrixA.transpose() * in;
-      out = _qr.solve(Au);
-
-      // Copy mapped data to output data values
-      for (int i = 0; i < out.size() - polyparams; i++) {
-        outputValues[i * valueDim + dim] = out[i];
-      }
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::stackInputData(const DataIDPairs &dataIDs, const std::vector<int> &offsets, bool ownedOnly) const
+{
+  Eigen::MatrixXd stacked;
+  for (size_t k = 0; k < dataIDs.size(); ++k) {
+    const int             valueDim = offsets[k + 1] - offsets[k];
+    const Eigen::VectorXd values   = ownedOnly ? input()->getOwnedVertexData(dataIDs[k].first) : input()->data(dataIDs[k].first)->values();
+    const int             rows     = values.size() / valueDim;
+    if (k == 0) {
+      stacked.resize(rows, offsets.back());
     }
+    PRECICE_ASSERT(stacked.rows() == rows, stacked.rows(), rows);
+    stacked.middleCols(offsets[k], valueDim) = Eigen::Map<const Eigen::MatrixXd>(values.data(), valueDim, rows).transpose();
+  }
+  return stacked;
+}
 
-    // Data scattering to slaves
-    if (utils::MasterSlave::isMaster()) {
-
-      // Filter data
-      int outputCounter = 0;
-      for (int i = 0; i < static_cast<int>(output()->vertices().size()); ++i) {
-        if (output()->vertices()[i].isOwner()) {
-          for (int dim = 0; dim < valueDim; ++dim) {
-            output()->data(outputDataID)->values()[i * valueDim + dim] = outputValues(outputCounter);
-            ++outputCounter;
-          }
-        }
-      }
-
-      // Data scattering to slaves
-      int beginPoint = outputValueSizes.at(0);
-      for (int rank = 1; rank < utils::MasterSlave::getSize(); ++rank) {
-        utils::MasterSlave::_communication->send(outputValues.data() + beginPoint, outputValueSizes.at(rank), rank);
-        beginPoint += outputValueSizes.at(rank);
-      }
-    } else { // Serial
-      output()->data(outputDataID)->values() = outputValues;
-    }
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename MATRIX_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConservative(const MATRIX_T &matrixA, const DataIDPairs &dataIDs, const std::vector<int> &offsets, int polyparams)
+{
+  PRECICE_TRACE(dataIDs.size(), polyparams);
+
+  // Every rank computes the contribution of its input values, which are summed up on all ranks
+  const Eigen::MatrixXd localIn = stackInputData(dataIDs, offsets, false);
+  PRECICE_ASSERT(localIn.rows() == matrixA.rows(), localIn.rows(), matrixA.rows());
+  Eigen::MatrixXd localAu = matrixA.transpose() * localIn; // rows == n
+  Eigen::MatrixXd Au(localAu.rows(), localAu.cols());
+  if (utils::MasterSlave::isMaster() || utils::MasterSlave::isSlave()) {
+    utils::MasterSlave::allreduceSum(localAu.data(), Au.data(), localAu.size());
+  } else {
+    Au = std::move(localAu);
   }
-  if (utils::MasterSlave::isSlave()) {
-    std::vector<double> receivedValues;
-    utils::MasterSlave::_communication->receive(receivedValues, 0);
 
-    int valueDim = output()->data(outputDataID)->getDimensions();
+  const Eigen::MatrixXd out = solveSystem(Au); // rows == n
 
-    int outputCounter = 0;
+  // Copy mapped data of owned vertices to output data values
+  for (size_t k = 0; k < dataIDs.size(); ++k) {
+    const int valueDim      = offsets[k + 1] - offsets[k];
+    auto &    outputValues  = output()->data(dataIDs[k].second)->values();
+    int       outputCounter = _globalInOffset;
     for (int i = 0; i < static_cast<int>(output()->vertices().size()); ++i) {
       if (output()->vertices()[i].isOwner()) {
         for (int dim = 0; dim < valueDim; ++dim) {
-          output()->data(outputDataID)->values()[i * valueDim + dim] = receivedValues.at(outputCounter);
-          ++outputCounter;
+          outputValues[i * valueDim + dim] = out(outputCounter, offsets[k] + dim);
         }
+        ++outputCounter;
       }
     }
+    PRECICE_ASSERT(outputCounter <= out.rows() - polyparams, outputCounter, out.rows(), polyparams);
   }
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConsistent(int inputDataID, int outputDataID, int polyparams)
+template <typename MATRIX_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConsistent(const MATRIX_T &matrixA, const DataIDPairs &dataIDs, const std::vector<int> &offsets, int polyparams)
 {
+  PRECICE_TRACE(dataIDs.size(), polyparams);
 
-  PRECICE_TRACE(inputDataID, outputDataID, polyparams);
-
-  // Gather input data
-  if (utils::MasterSlave::isSlave()) {
-    // Input data is filtered
-    auto localInDataFiltered = input()->getOwnedVertexData(inputDataID);
-    int  localOutputSize     = output()->data(outputDataID)->values().size();
-
-    // Send data and output size
-    utils::MasterSlave::_communication->send(localInDataFiltered.data(), localInDataFiltered.size(), 0);
-    utils::MasterSlave::_communication->send(localOutputSize, 0);
-
-  } else { // Master or Serial case
-
-    int valueDim = output()->data(outputDataID)->getDimensions();
-
-    std::vector<double> globalInValues((_matrixA.cols() - polyparams) * valueDim, 0.0);
-    std::vector<int>    outValuesSize;
-
-    if (utils::MasterSlave::isMaster()) { // Parallel case
-
-      // Filter input data
-      const auto &localInData = input()->getOwnedVertexData(inputDataID);
-      std::copy(localInData.data(), localInData.data() + localInData.size(), globalInValues.begin());
-      outValuesSize.push_back(output()->data(outputDataID)->values().size());
-
-      int inputSizeCounter = localInData.size();
-      int slaveOutDataSize{0};
-
-      std::vector<double> slaveBuffer;
-
-      for (int rank = 1; rank < utils::MasterSlave::getSize(); ++rank) {
-        utils::MasterSlave::_communication->receive(slaveBuffer, rank);
-        std::copy(slaveBuffer.begin(), slaveBuffer.end(), globalInValues.begin() + inputSizeCounter);
-        inputSizeCounter += slaveBuffer.size();
-
-        utils::MasterSlave::_communication->receive(slaveOutDataSize, rank);
-        outValuesSize.push_back(slaveOutDataSize);
-      }
-
-    } else { // Serial case
-      const auto &localInData = input()->data(inputDataID)->values();
-      std::copy(localInData.data(), localInData.data() + localInData.size(), globalInValues.begin());
-      outValuesSize.push_back(output()->data(outputDataID)->values().size());
-    }
-
-    Eigen::VectorXd p(_matrixA.cols());   // rows == n
-    Eigen::VectorXd in(_matrixA.cols());  // rows == n
-    Eigen::VectorXd out(_matrixA.rows()); // rows == outputSize
-    in.setZero();
-
-    // Construct Eigen vectors
-    Eigen::Map<Eigen::VectorXd> inputValues(globalInValues.data(), globalInValues.size());
-
-    Eigen::VectorXd outputValues((_matrixA.rows()) * valueDim);
-    outputValues.setZero();
-
-    // For every data dimension, perform mapping
-    for (int dim = 0; dim < valueDim; dim++) {
-      // Fill input from input data values (last polyparams entries remain zero)
-      for (int i = 0; i < in.size() - polyparams; i++) {
-        in[i] = inputValues[i * valueDim + dim];
-      }
-
-      p   = _qr.solve(in);
-      out = _matrixA * p;
-
-      // Copy mapped data to ouptut data values
-      for (int i = 0; i < out.size(); i++) {
-        outputValues[i * valueDim + dim] = out[i];
-      }
-    }
-
-    output()->data(outputDataID)->values() = Eigen::Map<Eigen::VectorXd>(outputValues.data(), outValuesSize.at(0));
+  // Input values at the rows of the interpolation system (last polyparams rows remain zero)
+  Eigen::MatrixXd in = Eigen::MatrixXd::Zero(matrixA.cols(), offsets.back());
 
-    // Data scattering to slaves
-    int beginPoint = outValuesSize.at(0);
-
-    if (utils::MasterSlave::isMaster()) {
-      for (int rank = 1; rank < utils::MasterSlave::getSize(); ++rank) {
-        utils::MasterSlave::_communication->send(outputValues.data() + beginPoint, outValuesSize.at(rank), rank);
-        beginPoint += outValuesSize.at(rank);
-      }
-    }
+  if (utils::MasterSlave::isMaster() || utils::MasterSlave::isSlave()) {
+    // Every rank contributes the values of its owned vertices
+    const Eigen::MatrixXd localInData = stackInputData(dataIDs, offsets, true);
+    Eigen::MatrixXd       localIn     = Eigen::MatrixXd::Zero(in.rows(), in.cols());
+    localIn.middleRows(_globalInOffset, localInData.rows()) = localInData;
+    utils::MasterSlave::allreduceSum(localIn.data(), in.data(), in.size());
+  } else {
+    in.topRows(matrixA.cols() - polyparams) = stackInputData(dataIDs, offsets, false);
   }
-  if (utils::MasterSlave::isSlave()) {
-    std::vector<double> receivedValues;
-    utils::MasterSlave::_communication->receive(receivedValues, 0);
-    output()->data(outputDataID)->values() = Eigen::Map<Eigen::VectorXd>(receivedValues.data(), receivedValues.size());
+
+  // Every rank evaluates the interpolant at its output vertices
+  const Eigen::MatrixXd coefficients = solveSystem(in); // rows == n
+  const Eigen::MatrixXd out          = matrixA * coefficients;
+  for (size_t k = 0; k < dataIDs.size(); ++k) {
+    const int valueDim     = offsets[k + 1] - offsets[k];
+    auto &    outputValues = output()->data(dataIDs[k].second)->values();
+    PRECICE_ASSERT(outputValues.size() == matrixA.rows() * valueDim, outputValues.size(), matrixA.rows(), valueDim);
+    Eigen::Map<Eigen::MatrixXd>(outputValues.data(), valueDim, matrixA.rows()) = out.middleCols(offsets[k], valueDim).transpose();
   }
 }
 
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::canMapConcurrently() const
+{
+  return not utils::MasterSlave::isMaster() && not utils::MasterSlave::isSlave();
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshFirstRound()
 {
@@ -527,6 +547,177 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshSecondRound()
 
 // ------- Non-Member Functions ---------
 
+/// Returns the coordinates of the vertices as rows, the dead axes are left out
+inline Eigen::MatrixXd reducedCoordinates(const mesh::Mesh &mesh, const std::vector<bool> &deadAxis)
+{
+  const int       reducedDimensions = std::count(deadAxis.begin(), deadAxis.end(), false);
+  Eigen::MatrixXd coordinates(mesh.vertices().size(), reducedDimensions);
+  for (size_t i = 0; i < mesh.vertices().size(); ++i) {
+    const auto &coords = mesh.vertices()[i].getCoords();
+    for (int d = 0, reduced = 0; d < mesh.getDimensions(); d++) {
+      if (not deadAxis[d])
+        coordinates(i, reduced++) = coords[d];
+    }
+  }
+  return coordinates;
+}
+
+/**
+ * @brief Evaluates the basis function for all pairs of points of two sets.
+ *
+ * Computes block(i, j) = basisFunction.evaluate(|rowCoords.row(i) - colCoords.row(j)|).
+ * The rows are processed in tiles, so that their coordinates stay in the cache while iterating
+ * over the columns. Within a tile, distances and basis function are evaluated as array
+ * expressions, which are vectorized by Eigen.
+ *
+ * @param[in] rowCoords coordinates of the points belonging to the rows of the block
+ * @param[in] colCoords coordinates of the points belonging to the columns of the block
+ * @param[out] block the block to fill, of size rowCoords.rows() x colCoords.rows()
+ * @param[in] upperOnly only fill the entries with i <= j
+ */
+template <typename RADIAL_BASIS_FUNCTION_T>
+void evaluateBasisFunction(const RADIAL_BASIS_FUNCTION_T &          basisFunction,
+                           const Eigen::Ref<const Eigen::MatrixXd> &rowCoords,
+                           const Eigen::Ref<const Eigen::MatrixXd> &colCoords,
+                           Eigen::Ref<Eigen::MatrixXd>              block,
+                           bool                                     upperOnly = false)
+{
+  PRECICE_ASSERT(rowCoords.cols() == colCoords.cols(), rowCoords.cols(), colCoords.cols());
+  PRECICE_ASSERT(block.rows() == rowCoords.rows() && block.cols() == colCoords.rows());
+
+  constexpr int tileSize = 256;
+  const int     rows     = rowCoords.rows();
+  const int     cols     = colCoords.rows();
+
+  Eigen::ArrayXd distances(tileSize);
+  for (int begin = 0; begin < rows; begin += tileSize) {
+    const int tileRows = std::min(tileSize, rows - begin);
+    for (int j = upperOnly ? begin : 0; j < cols; ++j) {
+      const int size = upperOnly ? std::min(tileRows, j - begin + 1) : tileRows;
+      auto      dist = distances.head(size);
+      dist.setZero();
+      for (int d = 0; d < rowCoords.cols(); d++) {
+        dist += (rowCoords.col(d).segment(begin, size).array() - colCoords(j, d)).square();
+      }
+      block.col(j).segment(begin, size) = basisFunction.evaluate(dist.sqrt()).matrix();
+    }
+  }
+}
+
+/**
+ * @brief Evaluation matrix of an RBF interpolant, which is never stored.
+ *
+ * Behaves like the matrix returned by buildMatrixA() in products with dense matrices.
+ * Its entries are recomputed in tiles of tileSize x tileSize during every product,
+ * which trades computation for memory. The tiles are distributed to threads via
+ * utils::parallelFor(), such that every thread writes to different rows of the result.
+ */
+template <typename RADIAL_BASIS_FUNCTION_T>
+class MatrixFreeEvaluation {
+public:
+  /// Proxy of the transposed matrix, which only supports products
+  struct Transposed {
+    const MatrixFreeEvaluation &matrix;
+
+    Eigen::MatrixXd operator*(const Eigen::MatrixXd &y) const
+    {
+      return matrix.transposeProduct(y);
+    }
+  };
+
+  /**
+   * @param[in] basisFunction the basis function to evaluate
+   * @param[in] inCoordinates reduced coordinates of the input vertices, see reducedCoordinates()
+   * @param[in] outCoordinates reduced coordinates of the output vertices
+   */
+  MatrixFreeEvaluation(const RADIAL_BASIS_FUNCTION_T &basisFunction, const Eigen::MatrixXd &inCoordinates, const Eigen::MatrixXd &outCoordinates)
+      : _basisFunction(basisFunction), _in(inCoordinates), _out(outCoordinates)
+  {
+    PRECICE_ASSERT(_in.cols() == _out.cols(), _in.cols(), _out.cols());
+  }
+
+  Eigen::Index rows() const
+  {
+    return _out.rows();
+  }
+
+  Eigen::Index cols() const
+  {
+    return _in.rows() + 1 + _in.cols();
+  }
+
+  /// Computes A * x
+  Eigen::MatrixXd operator*(const Eigen::MatrixXd &x) const
+  {
+    PRECICE_ASSERT(x.rows() == cols(), x.rows(), cols());
+    const Eigen::Index inputSize = _in.rows();
+
+    // Polynomial part
+    Eigen::MatrixXd result = _out * x.bottomRows(_in.cols());
+    result.rowwise() += x.row(inputSize);
+
+    const Eigen::Index outTiles = (rows() + tileSize - 1) / tileSize;
+    utils::parallelFor(outTiles, 1, [&](std::size_t first, std::size_t last) {
+      Eigen::MatrixXd block(tileSize, tileSize);
+      for (Eigen::Index o = first * tileSize; o < std::min<Eigen::Index>(last * tileSize, rows()); o += tileSize) {
+        const Eigen::Index outSize = std::min<Eigen::Index>(tileSize, rows() - o);
+        for (Eigen::Index i = 0; i < inputSize; i += tileSize) {
+          const Eigen::Index inSize = std::min<Eigen::Index>(tileSize, inputSize - i);
+          auto               tile   = block.topLeftCorner(outSize, inSize);
+          evaluateBasisFunction(_basisFunction, _out.middleRows(o, outSize), _in.middleRows(i, inSize), tile);
+          result.middleRows(o, outSize).noalias() += tile * x.middleRows(i, inSize);
+        }
+      }
+    });
+    return result;
+  }
+
+  Transposed transpose() const
+  {
+    return Transposed{*this};
+  }
+
+  /// Computes A^T * y
+  Eigen::MatrixXd transposeProduct(const Eigen::MatrixXd &y) const
+  {
+    PRECICE_ASSERT(y.rows() == rows(), y.rows(), rows());
+    const Eigen::Index inputSize = _in.rows();
+
+    Eigen::MatrixXd result(cols(), y.cols());
+    result.row(inputSize)         = y.colwise().sum();
+    result.bottomRows(_in.cols()) = _out.transpose() * y;
+    result.topRows(inputSize).setZero();
+
+    const Eigen::Index inTiles = (inputSize + tileSize - 1) / tileSize;
+    utils::parallelFor(inTiles, 1, [&](std::size_t first, std::size_t last) {
+      Eigen::MatrixXd block(tileSize, tileSize);
+      for (Eigen::Index i = first * tileSize; i < std::min<Eigen::Index>(last * tileSize, inputSize); i += tileSize) {
+        const Eigen::Index inSize = std::min<Eigen::Index>(tileSize, inputSize - i);
+        for (Eigen::Index o = 0; o < rows(); o += tileSize) {
+          const Eigen::Index outSize = std::min<Eigen::Index>(tileSize, rows() - o);
+          auto               tile    = block.topLeftCorner(outSize, inSize);
+          evaluateBasisFunction(_basisFunction, _out.middleRows(o, outSize), _in.middleRows(i, inSize), tile);
+          result.middleRows(i, inSize).noalias() += tile.transpose() * y.middleRows(o, outSize);
+        }
+      }
+    });
+    return result;
+  }
+
+private:
+  /// Edge length of the recomputed blocks, such that a block fits into the cache
+  static constexpr Eigen::Index tileSize = 128;
+
+  const RADIAL_BASIS_FUNCTION_T &_basisFunction;
+
+  const Eigen::MatrixXd &_in;
+
+  const Eigen::MatrixXd &_out;
+};
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+constexpr Eigen::Index MatrixFreeEvaluation<RADIAL_BASIS_FUNCTION_T>::tileSize;
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 Eigen::MatrixXd buildMatrixCLU(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, std::vector<bool> deadAxis)
 {
@@ -546,22 +737,13 @@ Eigen::MatrixXd buildMatrixCLU(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh
   Eigen::MatrixXd matrixCLU(n, n);
   matrixCLU.setZero();
 
-  for (int i = 0; i < inputSize; ++i) {
-    for (int j = i; j < inputSize; ++j) {
-      const auto &u   = inputMesh.vertices()[i].getCoords();
-      const auto &v   = inputMesh.vertices()[j].getCoords();
-      matrixCLU(i, j) = basisFunction.evaluate(utils::reduceVector((u - v), deadAxis).norm());
-    }
-
-    const auto reduced = utils::reduceVector(inputMesh.vertices()[i].getCoords(), deadAxis);
+  const Eigen::MatrixXd coordinates = reducedCoordinates(inputMesh, deadAxis);
+  evaluateBasisFunction(basisFunction, coordinates, coordinates, matrixCLU.topLeftCorner(inputSize, inputSize), true);
 
-    for (int dim = 0; dim < dimensions - deadDimensions; dim++) {
-      matrixCLU(i, inputSize + 1 + dim) = reduced[dim];
-    }
-    matrixCLU(i, inputSize) = 1.0;
-  }
+  matrixCLU.col(inputSize).head(inputSize).setOnes();
+  matrixCLU.block(0, inputSize + 1, inputSize, dimensions - deadDimensions) = coordinates;
 
-  matrixCLU.triangularView<Eigen::Lower>() = matrixCLU.transpose();
+  matrixCLU.triangularView<Eigen::StrictlyLower>() = matrixCLU.transpose();
 
   return matrixCLU;
 }
@@ -584,23 +766,121 @@ Eigen::MatrixXd buildMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::
   int n = inputSize + polyparams; // Add linear polynom degrees
 
   Eigen::MatrixXd matrixA(outputSize, n);
-  matrixA.setZero();
 
   // Fill _matrixA with values
+  const Eigen::MatrixXd outputCoordinates = reducedCoordinates(outputMesh, deadAxis);
+  evaluateBasisFunction(basisFunction, outputCoordinates, reducedCoordinates(inputMesh, deadAxis), matrixA.leftCols(inputSize));
+
+  matrixA.col(inputSize).setOnes();
+  matrixA.rightCols(dimensions - deadDimensions) = outputCoordinates;
+
+  return matrixA;
+}
+
+/// Returns the vertices of the indexed mesh within the support radius around coords, the dead axes are not restricted
+template <typename RADIAL_BASIS_FUNCTION_T>
+std::vector<size_t> getVerticesInSupport(query::Index &index, const RADIAL_BASIS_FUNCTION_T &basisFunction, const Eigen::VectorXd &coords, const std::vector<bool> &deadAxis)
+{
+  const double        radius = basisFunction.getSupportRadius();
+  std::vector<double> bounds;
+  for (int d = 0; d < coords.size(); d++) {
+    if (deadAxis[d]) {
+      bounds.push_back(std::numeric_limits<double>::lowest());
+      bounds.push_back(std::numeric_limits<double>::max());
+    } else {
+      bounds.push_back(coords[d] - radius);
+      bounds.push_back(coords[d] + radius);
+    }
+  }
+  return index.getVerticesInsideBox(mesh::BoundingBox(std::move(bounds)));
+}
+
+/// Sparse counterpart of buildMatrixCLU() for basis functions with compact support
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::SparseMatrix<double> buildSparseMatrixCLU(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::PtrMesh &inputMesh, std::vector<bool> deadAxis)
+{
+  int inputSize  = inputMesh->vertices().size();
+  int dimensions = inputMesh->getDimensions();
+
+  int deadDimensions = 0;
+  for (int d = 0; d < dimensions; d++) {
+    if (deadAxis[d])
+      deadDimensions += 1;
+  }
+
+  int polyparams = 1 + dimensions - deadDimensions;
+  PRECICE_ASSERT(inputSize >= 1 + polyparams, inputSize);
+  int n = inputSize + polyparams; // Add linear polynom degrees
+
+  query::Index                        index(inputMesh);
+  std::vector<Eigen::Triplet<double>> entries;
+
+  for (int i = 0; i < inputSize; ++i) {
+    const auto &u = inputMesh->vertices()[i].getCoords();
+    for (size_t j : getVerticesInSupport(index, basisFunction, u, deadAxis)) {
+      const auto & v     = inputMesh->vertices()[j].getCoords();
+      const double value = basisFunction.evaluate(utils::reduceVector((u - v), deadAxis).norm());
+      if (value != 0.0) {
+        entries.emplace_back(i, j, value);
+      }
+    }
+
+    const auto reduced = utils::reduceVector(u, deadAxis);
+
+    for (int dim = 0; dim < dimensions - deadDimensions; dim++) {
+      entries.emplace_back(i, inputSize + 1 + dim, reduced[dim]);
+      entries.emplace_back(inputSize + 1 + dim, i, reduced[dim]);
+    }
+    entries.emplace_back(i, inputSize, 1.0);
+    entries.emplace_back(inputSize, i, 1.0);
+  }
+
+  Eigen::SparseMatrix<double> matrixCLU(n, n);
+  matrixCLU.setFromTriplets(entries.begin(), entries.end());
+  return matrixCLU;
+}
+
+/// Sparse counterpart of buildMatrixA() for basis functions with compact support
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::SparseMatrix<double> buildSparseMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::PtrMesh &inputMesh, const mesh::Mesh &outputMesh, std::vector<bool> deadAxis)
+{
+  int inputSize  = inputMesh->vertices().size();
+  int outputSize = outputMesh.vertices().size();
+  int dimensions = inputMesh->getDimensions();
+
+  int deadDimensions = 0;
+  for (int d = 0; d < dimensions; d++) {
+    if (deadAxis[d])
+      deadDimensions += 1;
+  }
+
+  int polyparams = 1 + dimensions - deadDimensions;
+  PRECICE_ASSERT(inputSize >= 1 + polyparams, inputSize);
+  int n = inputSize + polyparams; // Add linear polynom degrees
+
+  query::Index                        index(inputMesh);
+  std::vector<Eigen::Triplet<double>> entries;
+
   for (int i = 0; i < outputSize; ++i) {
-    for (int j = 0; j < inputSize; ++j) {
-      const auto &u = outputMesh.vertices()[i].getCoords();
-      const auto &v = inputMesh.vertices()[j].getCoords();
-      matrixA(i, j) = basisFunction.evaluate(utils::reduceVector((u - v), deadAxis).norm());
+    const auto &u = outputMesh.vertices()[i].getCoords();
+    for (size_t j : getVerticesInSupport(index, basisFunction, u, deadAxis)) {
+      const auto & v     = inputMesh->vertices()[j].getCoords();
+      const double value = basisFunction.evaluate(utils::reduceVector((u - v), deadAxis).norm());
+      if (value != 0.0) {
+        entries.emplace_back(i, j, value);
+      }
     }
 
-    const auto reduced = utils::reduceVector(outputMesh.vertices()[i].getCoords(), deadAxis);
+    const auto reduced = utils::reduceVector(u, deadAxis);
 
     for (int dim = 0; dim < dimensions - deadDimensions; dim++) {
-      matrixA(i, inputSize + 1 + dim) = reduced[dim];
+      entries.emplace_back(i, inputSize + 1 + dim, reduced[dim]);
     }
-    matrixA(i, inputSize) = 1.0;
+    entries.emplace_back(i, inputSize, 1.0);
   }
+
+  Eigen::SparseMatrix<double> matrixA(outputSize, n);
+  matrixA.setFromTriplets(entries.begin(), entries.end());
   return matrixA;
 }
 
@@ -0,0 +1,153 @@
+#include "SparseOperator.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <utility>
+#include "logging/LogMacros.hpp"
+#include "utils/Threads.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace mapping {
+
+namespace {
+/// Minimal number of rows per thread, smaller operators are not worth the thread overhead
+constexpr std::size_t minRowsPerThread = 4096;
+
+/// Applies the rows [begin, end) of the matrix, the vertex values have a fixed size if DIM is not Eigen::Dynamic
+template <int DIM>
+void applyRows(const SparseOperator::Matrix &matrix, const double *input, double *output, int valueDimensions, std::size_t begin, std::size_t end)
+{
+  using Vector = Eigen::Matrix<double, DIM, 1>;
+
+  const int *   offsets = matrix.outerIndexPtr();
+  const int *   columns = matrix.innerIndexPtr();
+  const double *weights = matrix.valuePtr();
+  for (std::size_t i = begin; i < end; ++i) {
+    Vector sum = Vector::Zero(valueDimensions);
+    for (int k = offsets[i]; k < offsets[i + 1]; ++k) {
+      sum += weights[k] * Eigen::Map<const Vector>(input + static_cast<std::size_t>(columns[k]) * valueDimensions, valueDimensions);
+    }
+    Eigen::Map<Vector>(output + i * valueDimensions, valueDimensions) = sum;
+  }
+}
+} // namespace
+
+SparseOperator::SparseOperator(int rows, int cols, const std::vector<Triplet> &entries)
+    : _matrix(rows, cols)
+{
+  _matrix.setFromTriplets(entries.begin(), entries.end());
+  _matrix.makeCompressed();
+  analyzeStructure();
+}
+
+SparseOperator::SparseOperator(Matrix matrix)
+    : _matrix(std::move(matrix))
+{
+  _matrix.makeCompressed();
+  analyzeStructure();
+}
+
+void SparseOperator::analyzeStructure()
+{
+  const int *   offsets = _matrix.outerIndexPtr();
+  const int *   columns = _matrix.innerIndexPtr();
+  const double *weights = _matrix.valuePtr();
+
+  _isGather   = true;
+  _isIdentity = rows() == cols();
+  for (int i = 0; i < rows() && _isGather; ++i) {
+    _isGather   = offsets[i + 1] - offsets[i] == 1 && weights[offsets[i]] == 1.0;
+    _isIdentity = _isIdentity && _isGather && columns[offsets[i]] == i;
+  }
+}
+
+bool SparseOperator::empty() const
+{
+  return _matrix.rows() == 0 && _matrix.cols() == 0;
+}
+
+int SparseOperator::rows() const
+{
+  return _matrix.rows();
+}
+
+int SparseOperator::cols() const
+{
+  return _matrix.cols();
+}
+
+const SparseOperator::Matrix &SparseOperator::matrix() const
+{
+  return _matrix;
+}
+
+bool SparseOperator::isIdentity() const
+{
+  return _isIdentity;
+}
+
+bool SparseOperator::isGather() const
+{
+  return _isGather;
+}
+
+void SparseOperator::apply(const Eigen::VectorXd &input, Eigen::VectorXd &output, int valueDimensions) const
+{
+  PRECICE_TRACE(rows(), cols(), valueDimensions);
+  PRECICE_ASSERT(input.size() == static_cast<Eigen::Index>(cols()) * valueDimensions, input.size(), cols(), valueDimensions);
+  PRECICE_ASSERT(output.size() == static_cast<Eigen::Index>(rows()) * valueDimensions, output.size(), rows(), valueDimensions);
+
+  if (_isIdentity) {
+    output = input;
+    return;
+  }
+
+  if (_isGather) {
+    const int *columns = _matrix.innerIndexPtr();
+    utils::parallelFor(rows(), minRowsPerThread, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        std::copy_n(input.data() + static_cast<std::size_t>(columns[i]) * valueDimensions, valueDimensions, output.data() + i * valueDimensions);
+      }
+    });
+    return;
+  }
+
+  utils::parallelFor(rows(), minRowsPerThread, [&](std::size_t begin, std::size_t end) {
+    switch (valueDimensions) {
+    case 1:
+      applyRows<1>(_matrix, input.data(), output.data(), valueDimensions, begin, end);
+      break;
+    case 2:
+      applyRows<2>(_matrix, input.data(), output.data(), valueDimensions, begin, end);
+      break;
+    case 3:
+      applyRows<3>(_matrix, input.data(), output.data(), valueDimensions, begin, end);
+      break;
+    default:
+      applyRows<Eigen::Dynamic>(_matrix, input.data(), output.data(), valueDimensions, begin, end);
+    }
+  });
+}
+
+void SparseOperator::write(const std::string &filename) const
+{
+  PRECICE_TRACE(filename);
+  std::ofstream out(filename);
+  PRECICE_CHECK(out, "Could not open file \"" << filename << "\" to write the mapping operator.");
+  out << "%%MatrixMarket matrix coordinate real general\n";
+  out << rows() << ' ' << cols() << ' ' << _matrix.nonZeros() << '\n';
+  out << std::setprecision(std::numeric_limits<double>::max_digits10);
+  for (int i = 0; i < _matrix.outerSize(); ++i) {
+    for (Matrix::InnerIterator it(_matrix, i); it; ++it) {
+      // Matrix Market indices are one-based
+      out << it.row() + 1 << ' ' << it.col() + 1 << ' ' << it.value() << '\n';
+    }
+  }
+}
+
+} // namespace mapping
+} // namespace precice
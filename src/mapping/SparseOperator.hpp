@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+#include <string>
+#include <vector>
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace mapping {
+
+/**
+ * @brief Linear interpolation operator of a mapping in compressed sparse row format.
+ *
+ * Every row belongs to an output vertex, whose values are the weighted sum of the values of the
+ * input vertices in its columns. Consistent mappings store their interpolation matrix, conservative
+ * mappings store its transpose. Hence, mapping data is always a product with the stored matrix,
+ * in which the rows are distributed to the threads without write conflicts.
+ *
+ * Operators which copy a single input vertex to every output vertex, e.g. for matching meshes,
+ * are detected on construction and applied as a plain copy or gather.
+ */
+class SparseOperator {
+public:
+  using Matrix  = Eigen::SparseMatrix<double, Eigen::RowMajor, int>;
+  using Triplet = Eigen::Triplet<double, int>;
+
+  /// Creates an empty operator
+  SparseOperator() = default;
+
+  /// Creates the operator from (output vertex, input vertex, weight) triplets, duplicates are summed up
+  SparseOperator(int rows, int cols, const std::vector<Triplet> &entries);
+
+  /// Creates the operator from a matrix, rows belong to output vertices
+  explicit SparseOperator(Matrix matrix);
+
+  /// Returns true if the operator has not been set
+  bool empty() const;
+
+  /// Number of output vertices
+  int rows() const;
+
+  /// Number of input vertices
+  int cols() const;
+
+  const Matrix &matrix() const;
+
+  /// Returns true if every output vertex is a copy of the input vertex with the same index
+  bool isIdentity() const;
+
+  /// Returns true if every output vertex is a copy of a single input vertex
+  bool isGather() const;
+
+  /**
+   * @brief Computes output = A * input for data with valueDimensions components per vertex.
+   *
+   * The values are stored vertex by vertex, as in mesh::Data::values().
+   */
+  void apply(const Eigen::VectorXd &input, Eigen::VectorXd &output, int valueDimensions) const;
+
+  /// Writes the operator to a file in the Matrix Market coordinate format for offline analysis
+  void write(const std::string &filename) const;
+
+private:
+  mutable logging::Logger _log{"mapping::SparseOperator"};
+
+  /// Detects the structure of the matrix after it has been set
+  void analyzeStructure();
+
+  Matrix _matrix;
+
+  bool _isIdentity = false;
+
+  bool _isGather = false;
+};
+
+} // namespace mapping
+} // namespace precice
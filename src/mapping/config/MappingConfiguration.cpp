@@ -8,8 +8,10 @@
 #include <utility>
 #include "logging/LogMacros.hpp"
 #include "mapping/Mapping.hpp"
+#include "mapping/MappingCache.hpp"
 #include "mapping/NearestNeighborMapping.hpp"
 #include "mapping/NearestProjectionMapping.hpp"
+#include "mapping/PartitionOfUnityMapping.hpp"
 #include "mapping/PetRadialBasisFctMapping.hpp"
 #include "mapping/RadialBasisFctMapping.hpp"
 #include "mapping/impl/BasisFunctions.hpp"
@@ -54,6 +56,15 @@ MappingConfiguration::MappingConfiguration(
                                .setOptions({"estimate", "compute", "off", "save", "tree"});
   auto attrUseLU = makeXMLAttribute(ATTR_USE_QR, false)
                        .setDocumentation("If set to true, QR decomposition is used to solve the RBF system");
+  auto attrPartitionOfUnity = makeXMLAttribute(ATTR_PARTITION_OF_UNITY, false)
+                                  .setDocumentation("If set to true, the global RBF system is replaced by local RBF systems on overlapping clusters, "
+                                                    "which are blended using partition-of-unity weights.");
+  auto attrVerticesPerCluster = makeXMLAttribute(ATTR_VERTICES_PER_CLUSTER, 50)
+                                    .setDocumentation("Targeted number of vertices per cluster of the partition-of-unity RBF mapping");
+  auto attrEvaluationMemoryLimit = makeXMLAttribute(ATTR_EVALUATION_MEMORY_LIMIT, -1.0)
+                                       .setDocumentation("Memory in megabytes the evaluation matrix of an RBF mapping with global support may occupy per rank. "
+                                                         "If the matrix is larger, its entries are recomputed during every mapping instead of being stored. "
+                                                         "Negative values disable the limit. Only applies to the Eigen RBF mapping without partition of unity.");
 
   XMLTag::Occurrence occ = XMLTag::OCCUR_ARBITRARY;
   std::list<XMLTag>  tags;
@@ -112,15 +123,24 @@ MappingConfiguration::MappingConfiguration(
     tag.addAttribute(attrYDead);
     tag.addAttribute(attrZDead);
     tag.addAttribute(attrUseLU);
+    tag.addAttribute(attrPartitionOfUnity);
+    tag.addAttribute(attrVerticesPerCluster);
+    tag.addAttribute(attrEvaluationMemoryLimit);
   }
+
+  auto attrCacheDirectory = makeXMLAttribute(ATTR_CACHE_DIRECTORY, "")
+                                .setDocumentation("Directory to store computed mappings in and to load them from in later runs with identical meshes. "
+                                                  "Leave empty to disable the cache. Only mappings with timing=\"initial\" can be cached.");
   {
     XMLTag tag(*this, VALUE_NEAREST_NEIGHBOR, occ, TAG);
     tag.setDocumentation("Nearest-neighbour mapping which uses a rstar-spacial index tree to index meshes and run nearest-neighbour queries.");
+    tag.addAttribute(attrCacheDirectory);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_NEAREST_PROJECTION, occ, TAG);
     tag.setDocumentation("Nearest-projection mapping which uses a rstar-spacial index tree to index meshes and locate the nearest projections.");
+    tag.addAttribute(attrCacheDirectory);
     tags.push_back(tag);
   }
 
@@ -170,9 +190,12 @@ void MappingConfiguration::xmlTagCallback(
     double        supportRadius  = 0.0;
     double        solverRtol     = 1e-9;
     bool          xDead = false, yDead = false, zDead = false;
-    bool          useLU         = false;
-    Polynomial    polynomial    = Polynomial::ON;
-    Preallocation preallocation = Preallocation::TREE;
+    bool          useLU                 = false;
+    Polynomial    polynomial            = Polynomial::ON;
+    Preallocation preallocation         = Preallocation::TREE;
+    bool          partitionOfUnity      = false;
+    int           verticesPerCluster    = 50;
+    double        evaluationMemoryLimit = -1.0;
 
     if (tag.hasAttribute(ATTR_SHAPE_PARAM)) {
       shapeParameter = tag.getDoubleAttributeValue(ATTR_SHAPE_PARAM);
@@ -195,6 +218,15 @@ void MappingConfiguration::xmlTagCallback(
     if (tag.hasAttribute(ATTR_USE_QR)) {
       useLU = tag.getBooleanAttributeValue(ATTR_USE_QR);
     }
+    if (tag.hasAttribute(ATTR_PARTITION_OF_UNITY)) {
+      partitionOfUnity = tag.getBooleanAttributeValue(ATTR_PARTITION_OF_UNITY);
+    }
+    if (tag.hasAttribute(ATTR_VERTICES_PER_CLUSTER)) {
+      verticesPerCluster = tag.getIntAttributeValue(ATTR_VERTICES_PER_CLUSTER);
+    }
+    if (tag.hasAttribute(ATTR_EVALUATION_MEMORY_LIMIT)) {
+      evaluationMemoryLimit = tag.getDoubleAttributeValue(ATTR_EVALUATION_MEMORY_LIMIT);
+    }
     if (tag.hasAttribute("polynomial")) {
       std::string strPolynomial = tag.getStringAttributeValue("polynomial");
       if (strPolynomial == "separate")
@@ -224,7 +256,19 @@ void MappingConfiguration::xmlTagCallback(
                                                         shapeParameter, supportRadius, solverRtol,
                                                         xDead, yDead, zDead,
                                                         useLU,
-                                                        polynomial, preallocation);
+                                                        polynomial, preallocation,
+                                                        partitionOfUnity, verticesPerCluster,
+                                                        evaluationMemoryLimit);
+    if (tag.hasAttribute(ATTR_CACHE_DIRECTORY)) {
+      const std::string cacheDirectory = tag.getStringAttributeValue(ATTR_CACHE_DIRECTORY);
+      if (not cacheDirectory.empty()) {
+        // Mappings of changing meshes would store a new entry on every recomputation
+        PRECICE_CHECK(timing == INITIAL, "The mapping from mesh \"" << fromMesh << "\" to mesh \"" << toMesh << "\" "
+                                         << "cannot be cached, as it is not computed only once. "
+                                         << "Please remove the " << ATTR_CACHE_DIRECTORY << " attribute or use timing=\"" << VALUE_TIMING_INITIAL << "\".");
+        configuredMapping.mapping->setCache(std::make_shared<MappingCache>(cacheDirectory));
+      }
+    }
     checkDuplicates(configuredMapping);
     _mappings.push_back(configuredMapping);
   }
@@ -256,7 +300,10 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
     bool                             zDead,
     bool                             useLU,
     Polynomial                       polynomial,
-    Preallocation                    preallocation) const
+    Preallocation                    preallocation,
+    bool                             partitionOfUnity,
+    int                              verticesPerCluster,
+    double                           evaluationMemoryLimit) const
 {
   PRECICE_TRACE(direction, type, timing, shapeParameter, supportRadius);
   using namespace mapping;
@@ -316,44 +363,88 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
   usePETSc = true;
 #endif
 
-  if (usePETSc && (not useLU)) {
+  if (partitionOfUnity) {
+    rbfType = RBFType::PARTITION_OF_UNITY;
+  } else if (usePETSc && (not useLU)) {
     rbfType = RBFType::PETSc;
   } else {
     rbfType = RBFType::EIGEN;
   }
 
+  if (evaluationMemoryLimit >= 0.0 && rbfType != RBFType::EIGEN) {
+    PRECICE_WARN("The " << ATTR_EVALUATION_MEMORY_LIMIT << " of the mapping from mesh \"" << fromMeshName << "\" to mesh \"" << toMeshName << "\" "
+                        << "is ignored, as it only applies to the Eigen RBF mapping without partition of unity.");
+  }
+
   if (rbfType == RBFType::EIGEN) {
     PRECICE_DEBUG("Eigen RBF is used");
     if (type == VALUE_RBF_TPS) {
       configuredMapping.mapping = PtrMapping(
-          new RadialBasisFctMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(), xDead, yDead, zDead));
+          new RadialBasisFctMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(), xDead, yDead, zDead, evaluationMemoryLimit));
     } else if (type == VALUE_RBF_MULTIQUADRICS) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<Multiquadrics>(
-              constraintValue, dimensions, Multiquadrics(shapeParameter), xDead, yDead, zDead));
+              constraintValue, dimensions, Multiquadrics(shapeParameter), xDead, yDead, zDead, evaluationMemoryLimit));
     } else if (type == VALUE_RBF_INV_MULTIQUADRICS) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<InverseMultiquadrics>(
-              constraintValue, dimensions, InverseMultiquadrics(shapeParameter), xDead, yDead, zDead));
+              constraintValue, dimensions, InverseMultiquadrics(shapeParameter), xDead, yDead, zDead, evaluationMemoryLimit));
     } else if (type == VALUE_RBF_VOLUME_SPLINES) {
       configuredMapping.mapping = PtrMapping(
-          new RadialBasisFctMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(), xDead, yDead, zDead));
+          new RadialBasisFctMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(), xDead, yDead, zDead, evaluationMemoryLimit));
     } else if (type == VALUE_RBF_GAUSSIAN) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<Gaussian>(
-              constraintValue, dimensions, Gaussian(shapeParameter), xDead, yDead, zDead));
+              constraintValue, dimensions, Gaussian(shapeParameter), xDead, yDead, zDead, evaluationMemoryLimit));
     } else if (type == VALUE_RBF_CTPS_C2) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<CompactThinPlateSplinesC2>(
-              constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius), xDead, yDead, zDead));
+              constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius), xDead, yDead, zDead, evaluationMemoryLimit));
     } else if (type == VALUE_RBF_CPOLYNOMIAL_C0) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<CompactPolynomialC0>(
-              constraintValue, dimensions, CompactPolynomialC0(supportRadius), xDead, yDead, zDead));
+              constraintValue, dimensions, CompactPolynomialC0(supportRadius), xDead, yDead, zDead, evaluationMemoryLimit));
     } else if (type == VALUE_RBF_CPOLYNOMIAL_C6) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<CompactPolynomialC6>(
-              constraintValue, dimensions, CompactPolynomialC6(supportRadius), xDead, yDead, zDead));
+              constraintValue, dimensions, CompactPolynomialC6(supportRadius), xDead, yDead, zDead, evaluationMemoryLimit));
+    } else {
+      PRECICE_ERROR("Unknown mapping type!");
+    }
+  }
+
+  if (rbfType == RBFType::PARTITION_OF_UNITY) {
+    PRECICE_DEBUG("Partition-of-unity RBF is used");
+    if (type == VALUE_RBF_TPS) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(), xDead, yDead, zDead, verticesPerCluster));
+    } else if (type == VALUE_RBF_MULTIQUADRICS) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<Multiquadrics>(
+              constraintValue, dimensions, Multiquadrics(shapeParameter), xDead, yDead, zDead, verticesPerCluster));
+    } else if (type == VALUE_RBF_INV_MULTIQUADRICS) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<InverseMultiquadrics>(
+              constraintValue, dimensions, InverseMultiquadrics(shapeParameter), xDead, yDead, zDead, verticesPerCluster));
+    } else if (type == VALUE_RBF_VOLUME_SPLINES) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(), xDead, yDead, zDead, verticesPerCluster));
+    } else if (type == VALUE_RBF_GAUSSIAN) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<Gaussian>(
+              constraintValue, dimensions, Gaussian(shapeParameter), xDead, yDead, zDead, verticesPerCluster));
+    } else if (type == VALUE_RBF_CTPS_C2) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<CompactThinPlateSplinesC2>(
+              constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius), xDead, yDead, zDead, verticesPerCluster));
+    } else if (type == VALUE_RBF_CPOLYNOMIAL_C0) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<CompactPolynomialC0>(
+              constraintValue, dimensions, CompactPolynomialC0(supportRadius), xDead, yDead, zDead, verticesPerCluster));
+    } else if (type == VALUE_RBF_CPOLYNOMIAL_C6) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<CompactPolynomialC6>(
+              constraintValue, dimensions, CompactPolynomialC6(supportRadius), xDead, yDead, zDead, verticesPerCluster));
     } else {
       PRECICE_ERROR("Unknown mapping type!");
     }
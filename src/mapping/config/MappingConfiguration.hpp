@@ -32,7 +32,8 @@ enum class Preallocation {
 
 enum class RBFType {
   EIGEN,
-  PETSc
+  PETSc,
+  PARTITION_OF_UNITY
 };
 
 /// Performs XML configuration and holds configured mappings.
@@ -101,19 +102,23 @@ private:
 
   const std::string TAG = "mapping";
 
-  const std::string ATTR_DIRECTION      = "direction";
-  const std::string ATTR_FROM           = "from";
-  const std::string ATTR_TO             = "to";
-  const std::string ATTR_TIMING         = "timing";
-  const std::string ATTR_TYPE           = "type";
-  const std::string ATTR_CONSTRAINT     = "constraint";
-  const std::string ATTR_SHAPE_PARAM    = "shape-parameter";
-  const std::string ATTR_SUPPORT_RADIUS = "support-radius";
-  const std::string ATTR_SOLVER_RTOL    = "solver-rtol";
-  const std::string ATTR_X_DEAD         = "x-dead";
-  const std::string ATTR_Y_DEAD         = "y-dead";
-  const std::string ATTR_Z_DEAD         = "z-dead";
-  const std::string ATTR_USE_QR         = "use-qr-decomposition";
+  const std::string ATTR_DIRECTION               = "direction";
+  const std::string ATTR_FROM                    = "from";
+  const std::string ATTR_TO                      = "to";
+  const std::string ATTR_TIMING                  = "timing";
+  const std::string ATTR_TYPE                    = "type";
+  const std::string ATTR_CONSTRAINT              = "constraint";
+  const std::string ATTR_SHAPE_PARAM             = "shape-parameter";
+  const std::string ATTR_SUPPORT_RADIUS          = "support-radius";
+  const std::string ATTR_SOLVER_RTOL             = "solver-rtol";
+  const std::string ATTR_X_DEAD                  = "x-dead";
+  const std::string ATTR_Y_DEAD                  = "y-dead";
+  const std::string ATTR_Z_DEAD                  = "z-dead";
+  const std::string ATTR_USE_QR                  = "use-qr-decomposition";
+  const std::string ATTR_CACHE_DIRECTORY         = "cache-directory";
+  const std::string ATTR_PARTITION_OF_UNITY      = "partition-of-unity";
+  const std::string ATTR_VERTICES_PER_CLUSTER    = "vertices-per-cluster";
+  const std::string ATTR_EVALUATION_MEMORY_LIMIT = "evaluation-memory-limit";
 
   const std::string VALUE_WRITE        = "write";
   const std::string VALUE_READ         = "read";
@@ -155,7 +160,10 @@ private:
       bool                             zDead,
       bool                             useLU,
       Polynomial                       polynomial,
-      Preallocation                    preallocation) const;
+      Preallocation                    preallocation,
+      bool                             partitionOfUnity,
+      int                              verticesPerCluster,
+      double                           evaluationMemoryLimit) const;
 
   /// Check whether a mapping to and from the same mesh already exists
   void checkDuplicates(const ConfiguredMapping &mapping);
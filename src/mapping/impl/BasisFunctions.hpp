@@ -1,11 +1,18 @@
 #pragma once
 
+#include <Eigen/Core>
 #include "logging/Logger.hpp"
 #include "math/math.hpp"
 
 namespace precice {
 namespace mapping {
 
+/*
+ * All basis functions provide evaluate() for a single radius and for an array of radii.
+ * The latter is written as Eigen array expression, which allows Eigen to use vectorized
+ * exp, log and sqrt while assembling the interpolation matrices.
+ */
+
 /// Base class for RBF with compact support
 struct CompactSupportBase {
   static constexpr bool hasCompactSupport()
@@ -44,6 +51,11 @@ public:
     }
     return result;
   }
+
+  Eigen::ArrayXd evaluate(const Eigen::ArrayXd &radius) const
+  {
+    return (radius > math::NUMERICAL_ZERO_DIFFERENCE).select(radius.log() * radius.square(), 0.0);
+  }
 };
 
 /**
@@ -63,6 +75,11 @@ public:
     return std::sqrt(_cPow2 + std::pow(radius, 2));
   }
 
+  Eigen::ArrayXd evaluate(const Eigen::ArrayXd &radius) const
+  {
+    return (_cPow2 + radius.square()).sqrt();
+  }
+
 private:
   double _cPow2;
 };
@@ -89,6 +106,11 @@ public:
     return 1.0 / std::sqrt(_cPow2 + std::pow(radius, 2));
   }
 
+  Eigen::ArrayXd evaluate(const Eigen::ArrayXd &radius) const
+  {
+    return (_cPow2 + radius.square()).rsqrt();
+  }
+
 private:
   logging::Logger _log{"mapping::InverseMultiQuadrics"};
 
@@ -108,6 +130,11 @@ public:
   {
     return std::abs(radius);
   }
+
+  Eigen::ArrayXd evaluate(const Eigen::ArrayXd &radius) const
+  {
+    return radius.abs();
+  }
 };
 
 /**
@@ -149,6 +176,11 @@ public:
       return std::exp(-std::pow(_shape * radius, 2.0)) - _deltaY;
   }
 
+  Eigen::ArrayXd evaluate(const Eigen::ArrayXd &radius) const
+  {
+    return (radius > _supportRadius).select(0.0, (-(_shape * radius).square()).exp() - _deltaY);
+  }
+
 private:
   logging::Logger _log{"mapping::Gaussian"};
 
@@ -198,6 +230,13 @@ public:
     return 1.0 - 30.0 * pow(p, 2.0) - 10.0 * pow(p, 3.0) + 45.0 * pow(p, 4.0) - 6.0 * pow(p, 5.0) - 60.0 * log(pow(p, pow(p, 3.0)));
   }
 
+  Eigen::ArrayXd evaluate(const Eigen::ArrayXd &radius) const
+  {
+    const Eigen::ArrayXd p     = radius / _r;
+    const Eigen::ArrayXd pLogP = (p > 0.0).select(p.cube() * p.log(), 0.0);
+    return (radius >= _r).select(0.0, 1.0 - 30.0 * p.square() - 10.0 * p.cube() + 45.0 * p.square().square() - 6.0 * p.square().square() * p - 60.0 * pLogP);
+  }
+
 private:
   logging::Logger _log{"mapping::CompactThinPlateSplinesC2"};
 
@@ -235,6 +274,11 @@ public:
     return std::pow(1.0 - radius / _r, 2.0);
   }
 
+  Eigen::ArrayXd evaluate(const Eigen::ArrayXd &radius) const
+  {
+    return (radius >= _r).select(0.0, (1.0 - radius / _r).square());
+  }
+
 private:
   logging::Logger _log{"mapping::CompactPolynomialC0"};
 
@@ -274,6 +318,12 @@ public:
     return pow(1.0 - p, 8.0) * (32.0 * pow(p, 3.0) + 25.0 * pow(p, 2.0) + 8.0 * p + 1.0);
   }
 
+  Eigen::ArrayXd evaluate(const Eigen::ArrayXd &radius) const
+  {
+    const Eigen::ArrayXd p = radius / _r;
+    return (radius >= _r).select(0.0, (1.0 - p).square().square().square() * (((32.0 * p + 25.0) * p + 8.0) * p + 1.0));
+  }
+
 private:
   logging::Logger _log{"mapping::CompactPolynomialC6"};
 
@@ -0,0 +1,194 @@
+#include <Eigen/Core>
+#include <boost/filesystem.hpp>
+#include <memory>
+#include <string>
+#include "mapping/Mapping.hpp"
+#include "mapping/MappingCache.hpp"
+#include "mapping/NearestNeighborMapping.hpp"
+#include "mapping/NearestProjectionMapping.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "mesh/Vertex.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mesh;
+using precice::mapping::MappingCache;
+
+namespace {
+/// Creates a unique directory, which is removed at the end of the test
+struct TemporaryDirectory {
+  TemporaryDirectory()
+      : path(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("precice-mapping-cache-%%%%-%%%%"))
+  {
+  }
+
+  ~TemporaryDirectory()
+  {
+    boost::filesystem::remove_all(path);
+  }
+
+  boost::filesystem::path path;
+};
+
+PtrMesh lineMesh(const std::string &name, double shift)
+{
+  PtrMesh mesh(new Mesh(name, 2, false, testing::nextMeshID()));
+  auto &  v0 = mesh->createVertex(Eigen::Vector2d(0.0 + shift, 0.0));
+  auto &  v1 = mesh->createVertex(Eigen::Vector2d(1.0 + shift, 0.0));
+  auto &  v2 = mesh->createVertex(Eigen::Vector2d(2.0 + shift, 0.0));
+  mesh->createEdge(v0, v1);
+  mesh->createEdge(v1, v2);
+  mesh->createData("Data", 1);
+  mesh->allocateDataValues();
+  return mesh;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(MappingCacheTests)
+
+BOOST_AUTO_TEST_CASE(KeyDependsOnContent)
+{
+  PRECICE_TEST(1_rank);
+  auto key = MappingCache::computeKey("mapping", *lineMesh("A", 0.0), *lineMesh("B", 0.5));
+  BOOST_TEST(key.size() == 40);
+  BOOST_TEST(key == MappingCache::computeKey("mapping", *lineMesh("C", 0.0), *lineMesh("D", 0.5)));
+  BOOST_TEST(key != MappingCache::computeKey("other", *lineMesh("A", 0.0), *lineMesh("B", 0.5)));
+  BOOST_TEST(key != MappingCache::computeKey("mapping", *lineMesh("A", 0.0), *lineMesh("B", 0.25)));
+  BOOST_TEST(key != MappingCache::computeKey("mapping", *lineMesh("B", 0.5), *lineMesh("A", 0.0)));
+}
+
+BOOST_AUTO_TEST_CASE(StoreAndLoad)
+{
+  PRECICE_TEST(1_rank);
+  TemporaryDirectory  directory;
+  MappingCache        cache(directory.path.string());
+  PtrMesh             input  = lineMesh("A", 0.0);
+  PtrMesh             output = lineMesh("B", 0.5);
+  MappingCache::Entry entry;
+  BOOST_TEST(not cache.load("missing", *input, *output, entry));
+
+  MappingCache::Entry stored;
+  stored.offsets = {0, 2, 3};
+  stored.indices = {4, 5, 6};
+  stored.weights = {0.25, 0.75, 1.0};
+  cache.store("key", *input, *output, stored);
+
+  BOOST_TEST(cache.load("key", *input, *output, entry));
+  BOOST_TEST(entry.offsets == stored.offsets);
+  BOOST_TEST(entry.indices == stored.indices);
+  BOOST_TEST(entry.weights == stored.weights);
+  BOOST_TEST(not cache.load("other", *input, *output, entry));
+}
+
+/// Entries of colliding keys are rejected if the vertex counts of the meshes differ
+BOOST_AUTO_TEST_CASE(RejectsDifferentMeshSizes)
+{
+  PRECICE_TEST(1_rank);
+  TemporaryDirectory directory;
+  MappingCache       cache(directory.path.string());
+  PtrMesh            input  = lineMesh("A", 0.0);
+  PtrMesh            output = lineMesh("B", 0.5);
+  PtrMesh            larger = lineMesh("C", 0.5);
+  larger->createVertex(Eigen::Vector2d(3.0, 0.0));
+
+  MappingCache::Entry stored;
+  stored.indices = {0, 1, 2};
+  cache.store("key", *input, *output, stored);
+
+  MappingCache::Entry entry;
+  BOOST_TEST(not cache.load("key", *input, *larger, entry));
+  BOOST_TEST(not cache.load("key", *larger, *output, entry));
+  BOOST_TEST(cache.load("key", *input, *output, entry));
+}
+
+BOOST_AUTO_TEST_CASE(NearestNeighborUsesCache)
+{
+  PRECICE_TEST(1_rank);
+  TemporaryDirectory directory;
+  auto               cache  = std::make_shared<MappingCache>(directory.path.string());
+  PtrMesh            inMesh = lineMesh("InMesh", 0.0);
+  PtrMesh            outMesh(new Mesh("OutMesh", 2, false, testing::nextMeshID()));
+  outMesh->createVertex(Eigen::Vector2d(0.1, 0.0));
+  outMesh->createVertex(Eigen::Vector2d(1.9, 0.0));
+  PtrData outData = outMesh->createData("Data", 1);
+  outMesh->allocateDataValues();
+  PtrData inData  = inMesh->data(0);
+  inData->values() << 1.0, 2.0, 3.0;
+
+  {
+    mapping::NearestNeighborMapping mapping(mapping::Mapping::CONSISTENT, 2);
+    mapping.setCache(cache);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    mapping.map(inData->getID(), outData->getID());
+    BOOST_TEST(testing::equals(outData->values(), Eigen::Vector2d(1.0, 3.0)));
+  }
+
+  // Replace the cached entry to ensure the mapping is loaded instead of computed
+  const auto          key = MappingCache::computeKey("nearest-neighbor-consistent", *inMesh, *outMesh);
+  MappingCache::Entry entry;
+  BOOST_TEST(cache->load(key, *inMesh, *outMesh, entry));
+  BOOST_TEST(entry.indices == std::vector<int>({0, 2}));
+  entry.indices = {1, 1};
+  cache->store(key, *inMesh, *outMesh, entry);
+
+  {
+    mapping::NearestNeighborMapping mapping(mapping::Mapping::CONSISTENT, 2);
+    mapping.setCache(cache);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    mapping.map(inData->getID(), outData->getID());
+    BOOST_TEST(testing::equals(outData->values(), Eigen::Vector2d(2.0, 2.0)));
+  }
+
+  // Invalid entries are ignored
+  entry.indices = {1, 5};
+  cache->store(key, *inMesh, *outMesh, entry);
+  {
+    mapping::NearestNeighborMapping mapping(mapping::Mapping::CONSISTENT, 2);
+    mapping.setCache(cache);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    mapping.map(inData->getID(), outData->getID());
+    BOOST_TEST(testing::equals(outData->values(), Eigen::Vector2d(1.0, 3.0)));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(NearestProjectionUsesCache)
+{
+  PRECICE_TEST(1_rank);
+  TemporaryDirectory directory;
+  auto               cache  = std::make_shared<MappingCache>(directory.path.string());
+  PtrMesh            inMesh = lineMesh("InMesh", 0.0);
+  inMesh->computeState();
+  PtrMesh outMesh(new Mesh("OutMesh", 2, false, testing::nextMeshID()));
+  outMesh->createVertex(Eigen::Vector2d(0.25, 0.0));
+  outMesh->createVertex(Eigen::Vector2d(1.5, 0.0));
+  PtrData outData = outMesh->createData("Data", 1);
+  outMesh->allocateDataValues();
+  PtrData inData = inMesh->data(0);
+  inData->values() << 1.0, 2.0, 3.0;
+  const Eigen::Vector2d expected(1.25, 2.5);
+
+  for (int run = 0; run < 2; ++run) {
+    mapping::NearestProjectionMapping mapping(mapping::Mapping::CONSISTENT, 2);
+    mapping.setCache(cache);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    outData->values().setZero();
+    mapping.map(inData->getID(), outData->getID());
+    BOOST_TEST(testing::equals(outData->values(), expected));
+  }
+
+  const auto          key = MappingCache::computeKey("nearest-projection-consistent", *inMesh, *outMesh);
+  MappingCache::Entry entry;
+  BOOST_TEST(cache->load(key, *inMesh, *outMesh, entry));
+  BOOST_TEST(entry.offsets == std::vector<int>({0, 2, 4}));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // MappingCacheTests
+BOOST_AUTO_TEST_SUITE_END() // MappingTests
@@ -11,6 +11,7 @@
 #include "mesh/Vertex.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
+#include "utils/Threads.hpp"
 
 using namespace precice;
 using namespace precice::mesh;
@@ -166,5 +167,91 @@ BOOST_AUTO_TEST_CASE(ConservativeNonIncremental)
   BOOST_TEST(outValues(1) == 0.0);
 }
 
+BOOST_AUTO_TEST_CASE(IndependentOfThreads)
+{
+  PRECICE_TEST(1_rank);
+  // Many input vertices map to few output vertices and vice versa, large enough to be split across threads
+  PtrMesh fine(new Mesh("Fine", 2, false, testing::nextMeshID()));
+  PtrData fineData = fine->createData("Data", 2);
+  for (int i = 0; i < 20000; ++i) {
+    fine->createVertex(Eigen::Vector2d(0.001 * i, 0.5 * (i % 3)));
+  }
+  fine->allocateDataValues();
+
+  PtrMesh coarse(new Mesh("Coarse", 2, false, testing::nextMeshID()));
+  PtrData coarseData = coarse->createData("Data", 2);
+  for (int i = 0; i < 5000; ++i) {
+    coarse->createVertex(Eigen::Vector2d(0.004 * i, 0.0));
+  }
+  coarse->allocateDataValues();
+
+  for (auto constraint : {mapping::Mapping::CONSISTENT, mapping::Mapping::CONSERVATIVE}) {
+    const bool consistent = constraint == mapping::Mapping::CONSISTENT;
+    PtrMesh    from       = consistent ? coarse : fine;
+    PtrMesh    to         = consistent ? fine : coarse;
+    PtrData    fromData   = consistent ? coarseData : fineData;
+    PtrData    toData     = consistent ? fineData : coarseData;
+    fromData->values().setLinSpaced(1.0, 2.0);
+
+    Eigen::VectorXd expected;
+    for (int threads : {1, 4}) {
+      utils::ScopedThreadCount        threadCount(threads);
+      mapping::NearestNeighborMapping mapping(constraint, 2);
+      mapping.setMeshes(from, to);
+      mapping.computeMapping();
+      toData->values().setZero();
+      mapping.map(fromData->getID(), toData->getID());
+      if (threads == 1) {
+        expected = toData->values();
+      } else {
+        BOOST_TEST(toData->values() == expected);
+      }
+    }
+    if (not consistent) {
+      BOOST_TEST(math::equals(expected.sum(), fromData->values().sum(), 1e-8));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MatchingMeshes)
+{
+  PRECICE_TEST(1_rank);
+  // The output mesh contains the input vertices in reversed order, including a duplicated vertex
+  PtrMesh inMesh(new Mesh("InMesh", 2, false, testing::nextMeshID()));
+  PtrData inData = inMesh->createData("Data", 2);
+  inMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+  inMesh->createVertex(Eigen::Vector2d(1.0, -0.0));
+  inMesh->createVertex(Eigen::Vector2d(1.0, 0.0));
+  inMesh->createVertex(Eigen::Vector2d(0.3, 2.0));
+  inMesh->allocateDataValues();
+  inData->values() << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0;
+
+  PtrMesh outMesh(new Mesh("OutMesh", 2, false, testing::nextMeshID()));
+  PtrData outData = outMesh->createData("Data", 2);
+  outMesh->createVertex(Eigen::Vector2d(0.3, 2.0));
+  outMesh->createVertex(Eigen::Vector2d(1.0, 0.0));
+  outMesh->createVertex(Eigen::Vector2d(1.0, 0.0));
+  outMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+  outMesh->allocateDataValues();
+
+  for (auto constraint : {mapping::Mapping::CONSISTENT, mapping::Mapping::CONSERVATIVE}) {
+    mapping::NearestNeighborMapping mapping(constraint, 2);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    BOOST_TEST(mapping.getInterpolationOperator().isGather());
+    BOOST_TEST(!mapping.getInterpolationOperator().isIdentity());
+    mapping.map(inData->getID(), outData->getID());
+    Eigen::VectorXd expected(8);
+    expected << 7.0, 8.0, 3.0, 4.0, 5.0, 6.0, 1.0, 2.0;
+    BOOST_TEST(outData->values() == expected);
+  }
+
+  // Identical meshes are copied
+  mapping::NearestNeighborMapping mapping(mapping::Mapping::CONSISTENT, 2);
+  mapping.setMeshes(inMesh, inMesh);
+  mapping.computeMapping();
+  BOOST_TEST(mapping.getInterpolationOperator().isIdentity());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,5 +1,6 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include "mapping/Mapping.hpp"
@@ -8,8 +9,11 @@
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
+#include "query/FindClosest.hpp"
+#include "query/Index.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
+#include "utils/Threads.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
@@ -540,5 +544,196 @@ BOOST_AUTO_TEST_CASE(Query_3D_FullMesh)
   BOOST_TEST(outData->values()(0) == 1.0);
 }
 
+BOOST_AUTO_TEST_CASE(IndependentOfThreads)
+{
+  PRECICE_TEST(1_rank);
+  using namespace precice::mesh;
+  constexpr int dimensions = 3;
+
+  // Triangulated curved surface, the output vertices partially lie outside of it
+  constexpr int size = 20;
+  PtrMesh       inMesh(new Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  PtrData       inData = inMesh->createData("InData", 1);
+  for (int i = 0; i < size; ++i) {
+    for (int j = 0; j < size; ++j) {
+      const double x = i / (size - 1.0);
+      const double y = j / (size - 1.0);
+      inMesh->createVertex(Eigen::Vector3d(x, y, 0.2 * x * x - 0.1 * y));
+    }
+  }
+  auto vertex = [&](int i, int j) -> Vertex & { return inMesh->vertices()[i * size + j]; };
+  for (int i = 0; i + 1 < size; ++i) {
+    for (int j = 0; j + 1 < size; ++j) {
+      Edge &bottom   = inMesh->createEdge(vertex(i, j), vertex(i + 1, j));
+      Edge &right    = inMesh->createEdge(vertex(i + 1, j), vertex(i + 1, j + 1));
+      Edge &top      = inMesh->createEdge(vertex(i + 1, j + 1), vertex(i, j + 1));
+      Edge &left     = inMesh->createEdge(vertex(i, j + 1), vertex(i, j));
+      Edge &diagonal = inMesh->createEdge(vertex(i, j), vertex(i + 1, j + 1));
+      inMesh->createTriangle(bottom, right, diagonal);
+      inMesh->createTriangle(diagonal, top, left);
+    }
+  }
+  inMesh->allocateDataValues();
+  inMesh->computeState();
+  for (const Vertex &v : inMesh->vertices()) {
+    inData->values()[v.getID()] = 1.0 + v.getCoords()[0] - 2.0 * v.getCoords()[1];
+  }
+
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  PtrData outData = outMesh->createData("OutData", 1);
+  for (int i = 0; i < 50; ++i) {
+    for (int j = 0; j < 50; ++j) {
+      outMesh->createVertex(Eigen::Vector3d(-0.1 + 0.024 * i, -0.1 + 0.024 * j, 0.05));
+    }
+  }
+  outMesh->allocateDataValues();
+  outMesh->computeState();
+
+  Eigen::VectorXd expected;
+  for (int threads : {1, 4}) {
+    utils::ScopedThreadCount                   threadCount(threads);
+    precice::mapping::NearestProjectionMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    mapping.map(inData->getID(), outData->getID());
+    if (threads == 1) {
+      expected = outData->values();
+    } else {
+      BOOST_TEST(outData->values() == expected);
+    }
+  }
+
+  // The output values are interpolated from the input values
+  BOOST_TEST(expected.minCoeff() >= inData->values().minCoeff() - 1e-12);
+  BOOST_TEST(expected.maxCoeff() <= inData->values().maxCoeff() + 1e-12);
+}
+
+/// The closest bounding box of a folded surface does not necessarily belong to the closest triangle
+BOOST_AUTO_TEST_CASE(FoldedSurface)
+{
+  PRECICE_TEST(1_rank);
+  using namespace precice::mesh;
+  constexpr int dimensions = 3;
+
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  PtrData inData = inMesh->createData("InData", 1);
+
+  // Flat sheet in the plane z = 0
+  Vertex &a1 = inMesh->createVertex(Eigen::Vector3d(0.0, 0.0, 0.0));
+  Vertex &b1 = inMesh->createVertex(Eigen::Vector3d(1.0, 0.0, 0.0));
+  Vertex &c1 = inMesh->createVertex(Eigen::Vector3d(0.0, 1.0, 0.0));
+  inMesh->createTriangle(inMesh->createEdge(a1, b1), inMesh->createEdge(b1, c1), inMesh->createEdge(c1, a1));
+
+  // Slanted sheet in the plane x + z = 0.6, its bounding box encloses the space above the flat sheet
+  Vertex &a2 = inMesh->createVertex(Eigen::Vector3d(0.0, -1.0, 0.6));
+  Vertex &b2 = inMesh->createVertex(Eigen::Vector3d(0.0, 2.0, 0.6));
+  Vertex &c2 = inMesh->createVertex(Eigen::Vector3d(0.6, 0.5, 0.0));
+  inMesh->createTriangle(inMesh->createEdge(a2, b2), inMesh->createEdge(b2, c2), inMesh->createEdge(c2, a2));
+
+  inMesh->allocateDataValues();
+  inMesh->computeState();
+  inData->values() << 1.0, 1.0, 1.0, 2.0, 2.0, 2.0;
+
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  PtrData outData = outMesh->createData("OutData", 1);
+  // Closer to the flat sheet, although the bounding box of the slanted sheet is closer
+  outMesh->createVertex(Eigen::Vector3d(0.2, 0.2, 0.1));
+  // Closer to the slanted sheet
+  outMesh->createVertex(Eigen::Vector3d(0.45, 0.5, 0.25));
+  outMesh->allocateDataValues();
+  outMesh->computeState();
+
+  precice::mapping::NearestProjectionMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+
+  BOOST_TEST(outData->values()(0) == 1.0);
+  BOOST_TEST(outData->values()(1) == 2.0);
+}
+
+/// Compares the incremental query to the closest valid projection of all four nearest triangles
+BOOST_AUTO_TEST_CASE(FoldedSurfaceNearestFour)
+{
+  PRECICE_TEST(1_rank);
+  using namespace precice::mesh;
+  constexpr int dimensions = 3;
+
+  // Steep zig-zag folds, whose bounding boxes overlap the neighboring folds
+  constexpr int folds = 8;
+  constexpr int size  = 5;
+  PtrMesh       inMesh(new Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  PtrData       inData = inMesh->createData("InData", 1);
+  for (int i = 0; i <= folds; ++i) {
+    for (int j = 0; j < size; ++j) {
+      inMesh->createVertex(Eigen::Vector3d(0.1 * i, 0.25 * j, 0.5 * (i % 2)));
+    }
+  }
+  auto vertex = [&](int i, int j) -> Vertex & { return inMesh->vertices()[i * size + j]; };
+  for (int i = 0; i < folds; ++i) {
+    for (int j = 0; j + 1 < size; ++j) {
+      Edge &bottom   = inMesh->createEdge(vertex(i, j), vertex(i + 1, j));
+      Edge &right    = inMesh->createEdge(vertex(i + 1, j), vertex(i + 1, j + 1));
+      Edge &top      = inMesh->createEdge(vertex(i + 1, j + 1), vertex(i, j + 1));
+      Edge &left     = inMesh->createEdge(vertex(i, j + 1), vertex(i, j));
+      Edge &diagonal = inMesh->createEdge(vertex(i, j), vertex(i + 1, j + 1));
+      inMesh->createTriangle(bottom, right, diagonal);
+      inMesh->createTriangle(diagonal, top, left);
+    }
+  }
+  inMesh->allocateDataValues();
+  inMesh->computeState();
+  for (const Vertex &v : inMesh->vertices()) {
+    inData->values()[v.getID()] = 1.0 + v.getCoords()[0] - 2.0 * v.getCoords()[1] + 3.0 * v.getCoords()[2];
+  }
+
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  PtrData outData = outMesh->createData("OutData", 1);
+  for (int i = 0; i < 15; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      for (int k = 0; k < 5; ++k) {
+        outMesh->createVertex(Eigen::Vector3d(0.013 + 0.053 * i, 0.11 + 0.27 * j, 0.05 + 0.1 * k));
+      }
+    }
+  }
+  outMesh->allocateDataValues();
+  outMesh->computeState();
+
+  precice::mapping::NearestProjectionMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+
+  // Reference: evaluate all four nearest triangles and interpolate on the closest valid projection
+  query::Index index(inMesh);
+  int          compared = 0;
+  for (const Vertex &v : outMesh->vertices()) {
+    double closest   = std::numeric_limits<double>::max();
+    double reference = 0.0;
+    for (const auto &match : index.getClosestTriangles(v, 4)) {
+      auto elements = query::generateInterpolationElements(v, inMesh->triangles()[match.index]);
+      if (std::any_of(elements.begin(), elements.end(), [](const query::InterpolationElement &elem) { return elem.weight < 0.0; })) {
+        continue;
+      }
+      Eigen::Vector3d projection = Eigen::Vector3d::Zero();
+      double          value      = 0.0;
+      for (const auto &elem : elements) {
+        projection += elem.weight * elem.element->getCoords();
+        value += elem.weight * inData->values()[elem.element->getID()];
+      }
+      const double distance = (v.getCoords() - projection).norm();
+      if (distance < closest) {
+        closest   = distance;
+        reference = value;
+      }
+    }
+    if (closest < std::numeric_limits<double>::max()) {
+      BOOST_TEST(outData->values()[v.getID()] == reference);
+      ++compared;
+    }
+  }
+  BOOST_TEST(compared > 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
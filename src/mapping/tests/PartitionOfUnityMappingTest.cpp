@@ -0,0 +1,172 @@
+#include <Eigen/Core>
+#include <cmath>
+#include <memory>
+#include "mapping/Mapping.hpp"
+#include "mapping/PartitionOfUnityMapping.hpp"
+#include "mapping/impl/BasisFunctions.hpp"
+#include "math/constants.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "mesh/Vertex.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "utils/Threads.hpp"
+
+using namespace precice;
+using namespace precice::mesh;
+using namespace precice::mapping;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(PartitionOfUnityMapping)
+
+namespace {
+/// Creates a structured 2D mesh of size x size vertices on the unit square, slightly shifted by offset
+PtrMesh createSquareMesh(const std::string &name, int size, double offset)
+{
+  PtrMesh mesh(new Mesh(name, 2, false, testing::nextMeshID()));
+  mesh->createData("Data", 1);
+  for (int i = 0; i < size; ++i) {
+    for (int j = 0; j < size; ++j) {
+      mesh->createVertex(Eigen::Vector2d(offset + i / (size - 1.0), offset + j / (size - 1.0)));
+    }
+  }
+  mesh->allocateDataValues();
+  return mesh;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(ConsistentReproducesLinear)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh inMesh  = createSquareMesh("InMesh", 30, 0.0);
+  PtrMesh outMesh = createSquareMesh("OutMesh", 17, 0.01);
+
+  auto linear = [](const Eigen::VectorXd &x) { return 1.0 + 2.0 * x[0] - 0.5 * x[1]; };
+  for (const Vertex &v : inMesh->vertices()) {
+    inMesh->data().front()->values()[v.getID()] = linear(v.getCoords());
+  }
+
+  // Few vertices per cluster result in many clusters
+  mapping::PartitionOfUnityMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, 2, ThinPlateSplines(), false, false, false, 20);
+  mapping.setMeshes(inMesh, outMesh);
+  BOOST_TEST(mapping.hasComputedMapping() == false);
+  mapping.computeMapping();
+  BOOST_TEST(mapping.hasComputedMapping() == true);
+  mapping.map(inMesh->data().front()->getID(), outMesh->data().front()->getID());
+
+  for (const Vertex &v : outMesh->vertices()) {
+    BOOST_TEST(math::equals(outMesh->data().front()->values()[v.getID()], linear(v.getCoords()), 1e-8));
+  }
+
+  mapping.clear();
+  BOOST_TEST(mapping.hasComputedMapping() == false);
+}
+
+BOOST_AUTO_TEST_CASE(ConservativePreservesSum)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh inMesh  = createSquareMesh("InMesh", 17, 0.01);
+  PtrMesh outMesh = createSquareMesh("OutMesh", 30, 0.0);
+  inMesh->data().front()->values().setLinSpaced(1.0, 3.0);
+
+  mapping::PartitionOfUnityMapping<CompactPolynomialC6> mapping(Mapping::CONSERVATIVE, 2, CompactPolynomialC6(0.3), false, false, false, 20);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inMesh->data().front()->getID(), outMesh->data().front()->getID());
+
+  BOOST_TEST(math::equals(outMesh->data().front()->values().sum(), inMesh->data().front()->values().sum(), 1e-8));
+}
+
+BOOST_AUTO_TEST_CASE(CoplanarClusters)
+{
+  PRECICE_TEST(1_rank);
+  // A slanted planar surface in 3D does not determine the linear polynomial of the clusters
+  auto createPlane = [](const std::string &name, int size, double offset) {
+    PtrMesh mesh(new Mesh(name, 3, false, testing::nextMeshID()));
+    mesh->createData("Data", 1);
+    for (int i = 0; i < size; ++i) {
+      for (int j = 0; j < size; ++j) {
+        const double x = offset + i / (size - 1.0);
+        const double y = offset + j / (size - 1.0);
+        mesh->createVertex(Eigen::Vector3d(x, y, 0.5 + 0.3 * x - 0.2 * y));
+      }
+    }
+    mesh->allocateDataValues();
+    return mesh;
+  };
+  PtrMesh inMesh  = createPlane("InMesh", 30, 0.0);
+  PtrMesh outMesh = createPlane("OutMesh", 17, 0.01);
+
+  auto smooth = [](const Eigen::VectorXd &x) { return 1.0 + 0.5 * std::sin(2.0 * x[0]) * x[1]; };
+  for (const Vertex &v : inMesh->vertices()) {
+    inMesh->data().front()->values()[v.getID()] = smooth(v.getCoords());
+  }
+
+  mapping::PartitionOfUnityMapping<CompactPolynomialC6> mapping(Mapping::CONSISTENT, 3, CompactPolynomialC6(0.5), false, false, false, 20);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inMesh->data().front()->getID(), outMesh->data().front()->getID());
+
+  for (const Vertex &v : outMesh->vertices()) {
+    BOOST_TEST(math::equals(outMesh->data().front()->values()[v.getID()], smooth(v.getCoords()), 1e-2));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(DeadAxis)
+{
+  PRECICE_TEST(1_rank);
+  // The meshes are located at different heights, which is ignored
+  PtrMesh inMesh(new Mesh("InMesh", 2, false, testing::nextMeshID()));
+  PtrData inData = inMesh->createData("Data", 1);
+  for (int i = 0; i < 40; ++i) {
+    inMesh->createVertex(Eigen::Vector2d(0.025 * i, 1.0));
+  }
+  inMesh->allocateDataValues();
+  for (const Vertex &v : inMesh->vertices()) {
+    inData->values()[v.getID()] = 3.0 * v.getCoords()[0];
+  }
+
+  PtrMesh outMesh(new Mesh("OutMesh", 2, false, testing::nextMeshID()));
+  PtrData outData = outMesh->createData("Data", 1);
+  for (int i = 0; i < 25; ++i) {
+    outMesh->createVertex(Eigen::Vector2d(0.04 * i, 0.0));
+  }
+  outMesh->allocateDataValues();
+
+  mapping::PartitionOfUnityMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, 2, ThinPlateSplines(), false, true, false, 8);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+
+  for (const Vertex &v : outMesh->vertices()) {
+    BOOST_TEST(math::equals(outData->values()[v.getID()], 3.0 * v.getCoords()[0], 1e-8));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(IndependentOfThreads)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh inMesh  = createSquareMesh("InMesh", 40, 0.0);
+  PtrMesh outMesh = createSquareMesh("OutMesh", 25, 0.01);
+  for (const Vertex &v : inMesh->vertices()) {
+    inMesh->data().front()->values()[v.getID()] = std::sin(3.0 * v.getCoords()[0]) * v.getCoords()[1];
+  }
+
+  Eigen::VectorXd expected;
+  for (int threads : {1, 4}) {
+    utils::ScopedThreadCount                   threadCount(threads);
+    mapping::PartitionOfUnityMapping<Gaussian> mapping(Mapping::CONSISTENT, 2, Gaussian(30.0), false, false, false, 30);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    mapping.map(inMesh->data().front()->getID(), outMesh->data().front()->getID());
+    if (threads == 1) {
+      expected = outMesh->data().front()->values();
+    } else {
+      BOOST_TEST(outMesh->data().front()->values() == expected);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
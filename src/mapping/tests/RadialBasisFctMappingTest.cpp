@@ -13,6 +13,7 @@
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "mesh/Vertex.hpp"
+#include "query/Index.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
 
@@ -1854,6 +1855,193 @@ BOOST_AUTO_TEST_CASE(DeadAxis3D)
   BOOST_TEST(outData->values()(3) == 4.3);
 }
 
+BOOST_AUTO_TEST_CASE(SparseMatricesMatchDense)
+{
+  PRECICE_TEST(1_rank);
+  using Eigen::Vector3d;
+  int dimensions = 3;
+
+  CompactPolynomialC6 fct(1.2);
+  mesh::PtrMesh       inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  mesh::Mesh          outMesh("OutMesh", dimensions, false, testing::nextMeshID());
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      inMesh->createVertex(Vector3d(0.5 * i, 2.0 + 0.1 * j, 0.7 * j));
+      outMesh.createVertex(Vector3d(0.5 * i + 0.2, 1.5, 0.7 * j + 0.1));
+    }
+  }
+
+  for (const auto &deadAxis : {std::vector<bool>{false, false, false}, std::vector<bool>{false, true, false}}) {
+    Eigen::MatrixXd sparseCLU(buildSparseMatrixCLU(fct, inMesh, deadAxis));
+    BOOST_TEST(sparseCLU.isApprox(buildMatrixCLU(fct, *inMesh, deadAxis)));
+    Eigen::MatrixXd sparseA(buildSparseMatrixA(fct, inMesh, outMesh, deadAxis));
+    BOOST_TEST(sparseA.isApprox(buildMatrixA(fct, *inMesh, outMesh, deadAxis)));
+  }
+  query::clearCache(*inMesh);
+}
+
+BOOST_AUTO_TEST_CASE(MapBatchMatchesSingleMaps)
+{
+  PRECICE_TEST(1_rank);
+  using Eigen::Vector2d;
+  int dimensions = 2;
+
+  for (auto constraint : {Mapping::CONSISTENT, Mapping::CONSERVATIVE}) {
+    mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+    mesh::PtrData inScalar = inMesh->createData("InScalar", 1);
+    mesh::PtrData inVector = inMesh->createData("InVector", 2);
+    mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+    mesh::PtrData outScalar      = outMesh->createData("OutScalar", 1);
+    mesh::PtrData outVector      = outMesh->createData("OutVector", 2);
+    mesh::PtrData outScalarBatch = outMesh->createData("OutScalarBatch", 1);
+    mesh::PtrData outVectorBatch = outMesh->createData("OutVectorBatch", 2);
+    for (int i = 0; i < 5; ++i) {
+      for (int j = 0; j < 5; ++j) {
+        inMesh->createVertex(Vector2d(0.25 * i, 0.25 * j));
+      }
+      outMesh->createVertex(Vector2d(0.2 * i + 0.05, 0.3));
+      outMesh->createVertex(Vector2d(0.7, 0.2 * i + 0.05));
+    }
+    inMesh->allocateDataValues();
+    outMesh->allocateDataValues();
+    addGlobalIndex(inMesh);
+    addGlobalIndex(outMesh);
+    inScalar->values().setLinSpaced(1.0, 2.0);
+    inVector->values().setLinSpaced(-1.0, 3.0);
+
+    Gaussian                        fct(3.0);
+    RadialBasisFctMapping<Gaussian> mapping(constraint, dimensions, fct, false, false, false);
+    if (constraint == Mapping::CONSISTENT) {
+      mapping.setMeshes(inMesh, outMesh);
+    } else {
+      mapping.setMeshes(outMesh, inMesh);
+    }
+    mapping.computeMapping();
+
+    if (constraint == Mapping::CONSISTENT) {
+      mapping.map(inScalar->getID(), outScalar->getID());
+      mapping.map(inVector->getID(), outVector->getID());
+      mapping.mapBatch({{inScalar->getID(), outScalarBatch->getID()}, {inVector->getID(), outVectorBatch->getID()}});
+      BOOST_TEST(outScalarBatch->values().isApprox(outScalar->values()));
+      BOOST_TEST(outVectorBatch->values().isApprox(outVector->values()));
+    } else {
+      outScalar->values().setLinSpaced(1.0, 2.0);
+      outVector->values().setLinSpaced(-1.0, 3.0);
+      outScalarBatch->values() = outScalar->values();
+      outVectorBatch->values() = outVector->values();
+      mapping.map(outScalar->getID(), inScalar->getID());
+      Eigen::VectorXd scalar = inScalar->values();
+      mapping.map(outVector->getID(), inVector->getID());
+      Eigen::VectorXd vector = inVector->values();
+      mapping.mapBatch({{outScalarBatch->getID(), inScalar->getID()}, {outVectorBatch->getID(), inVector->getID()}});
+      BOOST_TEST(inScalar->values().isApprox(scalar));
+      BOOST_TEST(inVector->values().isApprox(vector));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ArrayEvaluationMatchesScalar)
+{
+  PRECICE_TEST(1_rank);
+  Eigen::ArrayXd radii = Eigen::ArrayXd::LinSpaced(301, 0.0, 3.0);
+
+  auto check = [&radii](const auto &fct) {
+    const Eigen::ArrayXd values = fct.evaluate(radii);
+    BOOST_TEST(values.size() == radii.size());
+    for (int i = 0; i < radii.size(); ++i) {
+      BOOST_TEST(math::equals(values[i], fct.evaluate(radii[i]), 1e-12));
+    }
+  };
+  check(ThinPlateSplines());
+  check(Multiquadrics(0.8));
+  check(InverseMultiquadrics(0.8));
+  check(VolumeSplines());
+  check(Gaussian(1.5));
+  check(Gaussian(1.5, 1.2));
+  check(CompactThinPlateSplinesC2(1.2));
+  check(CompactPolynomialC0(1.2));
+  check(CompactPolynomialC6(1.2));
+}
+
+BOOST_AUTO_TEST_CASE(MatrixFreeMatchesStored)
+{
+  PRECICE_TEST(1_rank);
+  using Eigen::Vector2d;
+  int dimensions = 2;
+
+  // Several tiles of the matrix-free evaluation in both directions
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData inData = inMesh->createData("InData", 2);
+  for (int i = 0; i < 20; ++i) {
+    for (int j = 0; j < 15; ++j) {
+      inMesh->createVertex(Vector2d(0.05 * i, 0.07 * j));
+    }
+  }
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData outData = outMesh->createData("OutData", 2);
+  for (int i = 0; i < 270; ++i) {
+    outMesh->createVertex(Vector2d(0.0037 * i, 0.5 + 0.3 * std::sin(0.1 * i)));
+  }
+  inMesh->allocateDataValues();
+  outMesh->allocateDataValues();
+  addGlobalIndex(inMesh);
+  addGlobalIndex(outMesh);
+
+  for (auto constraint : {Mapping::CONSISTENT, Mapping::CONSERVATIVE}) {
+    mesh::PtrData from = constraint == Mapping::CONSISTENT ? inData : outData;
+    mesh::PtrData to   = constraint == Mapping::CONSISTENT ? outData : inData;
+    Eigen::VectorXd stored;
+    for (double memoryLimit : {-1.0, 0.0}) {
+      RadialBasisFctMapping<ThinPlateSplines> mapping(constraint, dimensions, ThinPlateSplines(), false, false, false, memoryLimit);
+      if (constraint == Mapping::CONSISTENT) {
+        mapping.setMeshes(inMesh, outMesh);
+      } else {
+        mapping.setMeshes(outMesh, inMesh);
+      }
+      mapping.computeMapping();
+      from->values().setLinSpaced(-2.0, 5.0);
+      mapping.map(from->getID(), to->getID());
+      if (memoryLimit < 0.0) {
+        stored = to->values();
+      } else {
+        BOOST_TEST(to->values().isApprox(stored, 1e-9));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MatchingMeshesArePermuted)
+{
+  PRECICE_TEST(1_rank);
+  using Eigen::Vector2d;
+  int dimensions = 2;
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData inData = inMesh->createData("InData", 1);
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData outData = outMesh->createData("OutData", 1);
+  for (int i = 0; i < 6; ++i) {
+    inMesh->createVertex(Vector2d(0.2 * i, 0.1 * i * i));
+    outMesh->createVertex(Vector2d(0.2 * (5 - i), 0.1 * (5 - i) * (5 - i)));
+  }
+  inMesh->allocateDataValues();
+  outMesh->allocateDataValues();
+  addGlobalIndex(inMesh);
+  addGlobalIndex(outMesh);
+  inData->values() << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0;
+
+  for (auto constraint : {Mapping::CONSISTENT, Mapping::CONSERVATIVE}) {
+    RadialBasisFctMapping<ThinPlateSplines> mapping(constraint, dimensions, ThinPlateSplines(), false, false, false);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    BOOST_TEST(mapping.getInterpolationOperator().isGather());
+    mapping.map(inData->getID(), outData->getID());
+    BOOST_TEST(outData->values() == inData->values().reverse().eval());
+    mapping.clear();
+    BOOST_TEST(mapping.getInterpolationOperator().empty());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Serial
 
 BOOST_AUTO_TEST_SUITE_END() // RadialBasisFunctionMapping
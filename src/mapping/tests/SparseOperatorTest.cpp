@@ -0,0 +1,77 @@
+#include <Eigen/Core>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "mapping/SparseOperator.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mapping;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(SparseOperator)
+
+BOOST_AUTO_TEST_CASE(ApplyMatchesDenseProduct)
+{
+  PRECICE_TEST(1_rank);
+  // The first output vertex averages the input vertices 0 and 2, duplicates are summed up
+  std::vector<mapping::SparseOperator::Triplet> entries{
+      {0, 0, 0.25}, {0, 0, 0.25}, {0, 2, 0.5}, {1, 1, 1.0}, {2, 0, 0.1}, {2, 3, 0.9}};
+  mapping::SparseOperator op(3, 4, entries);
+  BOOST_TEST(!op.empty());
+  BOOST_TEST(op.rows() == 3);
+  BOOST_TEST(op.cols() == 4);
+
+  const Eigen::MatrixXd dense = op.matrix();
+  for (int dim : {1, 2, 3, 4}) {
+    Eigen::VectorXd input = Eigen::VectorXd::LinSpaced(4 * dim, 1.0, 8.0);
+    Eigen::VectorXd output(3 * dim);
+    output.setConstant(-1.0);
+    op.apply(input, output, dim);
+
+    const Eigen::Map<const Eigen::MatrixXd> in(input.data(), dim, 4);
+    const Eigen::MatrixXd                   expected = in * dense.transpose();
+    BOOST_TEST(Eigen::Map<const Eigen::MatrixXd>(output.data(), dim, 3).isApprox(expected));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  PRECICE_TEST(1_rank);
+  mapping::SparseOperator op;
+  BOOST_TEST(op.empty());
+  BOOST_TEST(op.rows() == 0);
+  BOOST_TEST(op.cols() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(WriteMatrixMarket)
+{
+  PRECICE_TEST(1_rank);
+  mapping::SparseOperator op(2, 3, {{0, 1, 0.5}, {1, 2, 2.0}});
+  const auto              path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("precice-sparse-operator-%%%%-%%%%.mtx");
+  op.write(path.string());
+
+  {
+    std::ifstream in(path.string());
+    std::string   header;
+    std::getline(in, header);
+    BOOST_TEST(header == "%%MatrixMarket matrix coordinate real general");
+    int rows, cols, nonZeros;
+    in >> rows >> cols >> nonZeros;
+    BOOST_TEST(rows == 2);
+    BOOST_TEST(cols == 3);
+    BOOST_TEST(nonZeros == 2);
+    int    row, col;
+    double value;
+    in >> row >> col >> value;
+    BOOST_TEST(row == 1);
+    BOOST_TEST(col == 2);
+    BOOST_TEST(value == 0.5);
+  }
+  boost::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
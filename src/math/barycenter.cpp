@@ -1,7 +1,6 @@
 #include "math/barycenter.hpp"
 #include <Eigen/Core>
 #include <Eigen/Geometry>
-#include <utility>
 #include "math/differences.hpp"
 #include "math/geometry.hpp"
 #include "utils/assertion.hpp"
@@ -10,95 +9,19 @@ namespace precice {
 namespace math {
 namespace barycenter {
 
-BarycentricCoordsAndProjected calcBarycentricCoordsForEdge(
-    const Eigen::VectorXd &edgeA,
-    const Eigen::VectorXd &edgeB,
-    const Eigen::VectorXd &edgeNormal,
-    const Eigen::VectorXd &location)
+namespace {
+
+/**
+ * Solves for the parameter s of the intersection point a + s(b-a) of the edge AB
+ * and the line through c and d.
+ */
+double intersectionParameter(
+    const Eigen::Vector2d &a,
+    const Eigen::Vector2d &b,
+    const Eigen::Vector2d &c,
+    const Eigen::Vector2d &d)
 {
-  using Eigen::Vector2d;
-  using Eigen::Vector3d;
-  using Eigen::VectorXd;
-
-  const int dimensions = edgeA.size();
-  PRECICE_ASSERT(dimensions == edgeB.size() && dimensions == edgeNormal.size() && dimensions == location.size(),
-                 "The inputs need to have the same dimensions.");
-  PRECICE_ASSERT((dimensions == 2) || (dimensions == 3), dimensions);
-
-  Vector2d barycentricCoords;
-  VectorXd projected = VectorXd::Zero(dimensions);
-  Vector2d a, b, ab, c, d;
-  bool     collinear = false;
-
-  if (dimensions == 2) {
-    // Get parameters for parametric edge representation: p(s) = a + s(b-a)
-    a  = edgeA.head<2>();
-    b  = edgeB.head<2>();
-    ab = b;
-    ab -= a;
-    // Same for intersecting normal from searchpoint: q(t) = c + t(d - c)
-    c = location.head<2>();
-    d = location.head<2>();
-    d += edgeNormal;
-    collinear = math::geometry::collinear(a, b, c);
-    if (collinear) {
-      // From p(s) = a + s(b-a) we get: s = (p(s) - a) / (b-a)
-      int iMax;
-      ab.cwiseAbs().maxCoeff(&iMax);
-      PRECICE_ASSERT(!math::equals(ab(iMax), 0.0));
-      barycentricCoords[0] = (location(iMax) - a(iMax)) / ab(iMax);
-      barycentricCoords[1] = 1.0 - barycentricCoords[0];
-      projected            = location.head<2>();
-      std::swap(barycentricCoords(0), barycentricCoords(1));
-      return {barycentricCoords, projected};
-    }
-  } else { // 3D
-    PRECICE_ASSERT(dimensions == 3, dimensions);
-    // Get parameters for parametric triangle representation: p(s) = a + s(b-a)
-    Vector3d a3D  = edgeA;
-    Vector3d b3D  = edgeB;
-    Vector3d c3D  = location;
-    Vector3d ab3D = b3D - a3D;
-    Vector3d ac3D = c3D - a3D;
-    collinear     = math::geometry::collinear(a3D, b3D, c3D);
-    if (collinear) {
-      // From p(s) = a + s(b-a) we get: s = (p(s) - a) / (b-a)
-      int iMax;
-      ab3D.cwiseAbs().maxCoeff(&iMax);
-      PRECICE_ASSERT(!math::equals(ab3D[iMax], 0.0));
-      barycentricCoords[0] =
-          (location(iMax) - edgeA(iMax)) / ab3D(iMax);
-      barycentricCoords[1] = 1.0 - barycentricCoords[0];
-      projected            = location;
-      std::swap(barycentricCoords(0), barycentricCoords(1));
-      return {barycentricCoords, projected};
-    }
-    // Project parameters to 2D, where the projection plane is determined from
-    // the normal direction, in order to prevent "faulty" projections.
-    Vector3d normal;
-    normal = ab3D.cross(ac3D);
-    int indexToRemove;
-    normal.cwiseAbs().maxCoeff(&indexToRemove);
-    int indices[2];
-    if (indexToRemove == 0) {
-      indices[0] = 1;
-      indices[1] = 2;
-    } else if (indexToRemove == 1) {
-      indices[0] = 0;
-      indices[1] = 2;
-    } else {
-      PRECICE_ASSERT(indexToRemove == 2, indexToRemove);
-      indices[0] = 0;
-      indices[1] = 1;
-    }
-    a << a3D[indices[0]], a3D[indices[1]];
-    b << b3D[indices[0]], b3D[indices[1]];
-    ab << ab3D[indices[0]], ab3D[indices[1]];
-    c << c3D[indices[0]], c3D[indices[1]];
-    // 3D normal might be projected out, hence, compute new 2D edge normal
-    Vector2d normal2D(-1.0 * ab(1), ab(0));
-    d = c + normal2D;
-  }
+  const Eigen::Vector2d ab = b - a;
 
   // Compute denominator for solving 2x2 equation system
   double D = a(0) * (d(1) - c(1)) + b(0) * (c(1) - d(1)) + d(0) * ab(1) - c(0) * ab(1);
@@ -106,75 +29,123 @@ BarycentricCoordsAndProjected calcBarycentricCoordsForEdge(
 
   // Compute triangle segment parameter s, which is in [0, 1], if the
   // intersection point is within the triangle.
-  barycentricCoords[0] = (a(0) * (d(1) - c(1)) +
-                          c(0) * (a(1) - d(1)) +
-                          d(0) * (c(1) - a(1))) /
-                         D;
-  barycentricCoords[1] = 1.0 - barycentricCoords[0];
-
-  // Compute coordinates of projected point, which has to be done dimension
-  // dependent again:
-  if (dimensions == 2) {
-    projected = ab;                    // = b - a
-    projected *= barycentricCoords[0]; // = bary0 * (b - a)
-    projected += a;                    // = a + bary0 * (b - a)
-  } else {
-    projected = edgeB;                 // = b
-    projected -= edgeA;                // = b - a
-    projected *= barycentricCoords[0]; // = bary0 * (b - a)
-    projected += edgeA;                // = a + bary0 * (b - a)
+  return (a(0) * (d(1) - c(1)) +
+          c(0) * (a(1) - d(1)) +
+          d(0) * (c(1) - a(1))) /
+         D;
+}
+
+/// Computes the barycentric coordinates of a collinear location on the edge AB
+template <int Dim>
+BarycentricCoordsAndProjected collinearEdgeCoords(
+    const Eigen::Matrix<double, Dim, 1> &a,
+    const Eigen::Matrix<double, Dim, 1> &b,
+    const Eigen::Matrix<double, Dim, 1> &location)
+{
+  // From p(s) = a + s(b-a) we get: s = (p(s) - a) / (b-a)
+  const Eigen::Matrix<double, Dim, 1> ab = b - a;
+  int                                 iMax;
+  ab.cwiseAbs().maxCoeff(&iMax);
+  PRECICE_ASSERT(!math::equals(ab(iMax), 0.0));
+  const double s = (location(iMax) - a(iMax)) / ab(iMax);
+  return {Eigen::Vector2d(1.0 - s, s), location};
+}
+
+BarycentricCoordsAndProjected edgeCoords2D(
+    const Eigen::Vector2d &a,
+    const Eigen::Vector2d &b,
+    const Eigen::Vector2d &normal,
+    const Eigen::Vector2d &location)
+{
+  if (math::geometry::collinear(a, b, location)) {
+    return collinearEdgeCoords<2>(a, b, location);
   }
+  // Intersect the parametric edge representation p(s) = a + s(b-a) with the
+  // normal from the searchpoint q(t) = c + t(d - c)
+  const double          s         = intersectionParameter(a, b, location, location + normal);
+  const Eigen::Vector2d projected = a + s * (b - a);
+  return {Eigen::Vector2d(1.0 - s, s), projected};
+}
 
-  std::swap(barycentricCoords(0), barycentricCoords(1));
-  return {barycentricCoords, projected};
+BarycentricCoordsAndProjected edgeCoords3D(
+    const Eigen::Vector3d &a,
+    const Eigen::Vector3d &b,
+    const Eigen::Vector3d &location)
+{
+  if (math::geometry::collinear(a, b, location)) {
+    return collinearEdgeCoords<3>(a, b, location);
+  }
+  // Project parameters to 2D, where the projection plane is determined from
+  // the normal direction, in order to prevent "faulty" projections.
+  const Eigen::Vector3d normal = (b - a).cross(location - a);
+  int                   indexToRemove;
+  normal.cwiseAbs().maxCoeff(&indexToRemove);
+  const Eigen::Vector2d a2D = math::geometry::projectVector(a, indexToRemove);
+  const Eigen::Vector2d b2D = math::geometry::projectVector(b, indexToRemove);
+  const Eigen::Vector2d c2D = math::geometry::projectVector(location, indexToRemove);
+  // 3D normal might be projected out, hence, compute new 2D edge normal
+  const Eigen::Vector2d ab2D = b2D - a2D;
+  const Eigen::Vector2d normal2D(-1.0 * ab2D(1), ab2D(0));
+
+  const double          s         = intersectionParameter(a2D, b2D, c2D, c2D + normal2D);
+  const Eigen::Vector3d projected = a + s * (b - a);
+  return {Eigen::Vector2d(1.0 - s, s), projected};
+}
+
+} // namespace
+
+BarycentricCoordsAndProjected calcBarycentricCoordsForEdge(
+    const Eigen::Ref<const Eigen::VectorXd> &edgeA,
+    const Eigen::Ref<const Eigen::VectorXd> &edgeB,
+    const Eigen::Ref<const Eigen::VectorXd> &edgeNormal,
+    const Eigen::Ref<const Eigen::VectorXd> &location)
+{
+  const int dimensions = edgeA.size();
+  PRECICE_ASSERT(dimensions == edgeB.size() && dimensions == edgeNormal.size() && dimensions == location.size(),
+                 "The inputs need to have the same dimensions.");
+  PRECICE_ASSERT((dimensions == 2) || (dimensions == 3), dimensions);
+
+  if (dimensions == 2) {
+    return edgeCoords2D(edgeA.head<2>(), edgeB.head<2>(), edgeNormal.head<2>(), location.head<2>());
+  }
+  return edgeCoords3D(edgeA.head<3>(), edgeB.head<3>(), location.head<3>());
 }
 
 BarycentricCoordsAndProjected calcBarycentricCoordsForTriangle(
-    const Eigen::VectorXd &a,
-    const Eigen::VectorXd &b,
-    const Eigen::VectorXd &c,
-    const Eigen::VectorXd &normal,
-    const Eigen::VectorXd &location)
+    const Eigen::Ref<const Eigen::VectorXd> &a,
+    const Eigen::Ref<const Eigen::VectorXd> &b,
+    const Eigen::Ref<const Eigen::VectorXd> &c,
+    const Eigen::Ref<const Eigen::VectorXd> &normal,
+    const Eigen::Ref<const Eigen::VectorXd> &location)
 {
   using Eigen::Vector2d;
   using Eigen::Vector3d;
+  PRECICE_ASSERT(a.size() == 3 && b.size() == 3 && c.size() == 3 && normal.size() == 3 && location.size() == 3,
+                 "Triangles are only supported in 3D.");
+  const Vector3d a3D      = a.head<3>();
+  const Vector3d b3D      = b.head<3>();
+  const Vector3d c3D      = c.head<3>();
+  const Vector3d normal3D = normal.head<3>();
 
   // Parametric representation for triangle plane:
   // (x, y, z) * normal = d
-  const double d = normal.dot(a);
+  const double d = normal3D.dot(a3D);
 
   // Parametric description of line from searchpoint orthogonal to triangle:
   // location + t * normal = x     (where t is parameter)
   // Determine t such that x lies on triangle plane:
-  const double t = d - location.dot(normal) / normal.dot(normal);
+  const double t = d - location.head<3>().dot(normal3D) / normal3D.dot(normal3D);
 
   // Compute projected point with parameter t:
-  Vector3d projected = normal;
-  projected *= t;
-  projected += location;
+  const Vector3d projected = location.head<3>() + t * normal3D;
 
   // Project everything to 2D
   int iMax;
-  normal.cwiseAbs().maxCoeff(&iMax);
-  int indices[2];
-  if (iMax == 0) {
-    indices[0] = 1;
-    indices[1] = 2;
-  } else if (iMax == 1) {
-    indices[0] = 0;
-    indices[1] = 2;
-  } else {
-    PRECICE_ASSERT(iMax == 2, iMax);
-    indices[0] = 0;
-    indices[1] = 1;
-  }
-  Vector2d a2D(a[indices[0]],
-               a[indices[1]]);
-  Vector2d b2D(b[indices[0]],
-               b[indices[1]]);
-  Vector2d c2D(c[indices[0]],
-               c[indices[1]]);
-  Vector2d projected2D(projected[indices[0]], projected[indices[1]]);
+  normal3D.cwiseAbs().maxCoeff(&iMax);
+  const Vector2d a2D         = math::geometry::projectVector(a3D, iMax);
+  const Vector2d b2D         = math::geometry::projectVector(b3D, iMax);
+  const Vector2d c2D         = math::geometry::projectVector(c3D, iMax);
+  const Vector2d projected2D = math::geometry::projectVector(projected, iMax);
   // Compute barycentric coordinates by solving linear 3x3 system
   Vector3d                    rhs(projected2D(0), projected2D(1), 1);
   Eigen::Matrix<double, 3, 3> A;
@@ -9,12 +9,15 @@ namespace math {
 /// Provides operations to calculate barycentric coordinates and projection from a point to a primitive.
 namespace barycenter {
 
+/// Vector of at most 3 entries, which is stored without heap allocation.
+using BoundedVector = Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, 3, 1>;
+
 /// The result of calculating the barycentric coordinates.
 struct BarycentricCoordsAndProjected {
   /// A vector of the n coefficients for n vertices
-  Eigen::VectorXd barycentricCoords;
+  BoundedVector barycentricCoords;
   /// The projected location vertex
-  Eigen::VectorXd projected;
+  BoundedVector projected;
 };
 
 /** Takes the corner vertices of an edge and its norm.
@@ -27,10 +30,10 @@ struct BarycentricCoordsAndProjected {
  * @note Methodology of book "Computational Geometry", Joseph O' Rourke, Chapter 7.2
  */
 BarycentricCoordsAndProjected calcBarycentricCoordsForEdge(
-    const Eigen::VectorXd &edgeA,
-    const Eigen::VectorXd &edgeB,
-    const Eigen::VectorXd &edgeNormal,
-    const Eigen::VectorXd &location);
+    const Eigen::Ref<const Eigen::VectorXd> &edgeA,
+    const Eigen::Ref<const Eigen::VectorXd> &edgeB,
+    const Eigen::Ref<const Eigen::VectorXd> &edgeNormal,
+    const Eigen::Ref<const Eigen::VectorXd> &location);
 
 /** Takes the corner vertices of a triangle and its norm.
  *  It then calculates the projection of a location vector and generates the barycentric coordinates for the corner points.
@@ -47,11 +50,11 @@ BarycentricCoordsAndProjected calcBarycentricCoordsForEdge(
  * of outprojecting one coordinate
  */
 BarycentricCoordsAndProjected calcBarycentricCoordsForTriangle(
-    const Eigen::VectorXd &a,
-    const Eigen::VectorXd &b,
-    const Eigen::VectorXd &c,
-    const Eigen::VectorXd &normal,
-    const Eigen::VectorXd &location);
+    const Eigen::Ref<const Eigen::VectorXd> &a,
+    const Eigen::Ref<const Eigen::VectorXd> &b,
+    const Eigen::Ref<const Eigen::VectorXd> &c,
+    const Eigen::Ref<const Eigen::VectorXd> &normal,
+    const Eigen::Ref<const Eigen::VectorXd> &location);
 
 } // namespace barycenter
 } // namespace math
@@ -157,24 +157,20 @@ ResultConstants segmentPlaneIntersection(
 }
 
 double triangleArea(
-    const Eigen::VectorXd &a,
-    const Eigen::VectorXd &b,
-    const Eigen::VectorXd &c)
+    const Eigen::Ref<const Eigen::VectorXd> &a,
+    const Eigen::Ref<const Eigen::VectorXd> &b,
+    const Eigen::Ref<const Eigen::VectorXd> &c)
 {
   PRECICE_ASSERT(a.size() == b.size(), a.size(), b.size());
   PRECICE_ASSERT(b.size() == c.size(), b.size(), c.size());
   if (a.size() == 2) {
-    Eigen::Vector2d A = b;
-    A -= a;
-    Eigen::Vector2d B = c;
-    B -= a;
+    const Eigen::Vector2d A = b.head<2>() - a.head<2>();
+    const Eigen::Vector2d B = c.head<2>() - a.head<2>();
     return 0.5 * (A(0) * B(1) - A(1) * B(0));
   } else {
     PRECICE_ASSERT(a.size() == 3, a.size());
-    Eigen::Vector3d A = b;
-    A -= a;
-    Eigen::Vector3d B = c;
-    B -= a;
+    const Eigen::Vector3d A = b.head<3>() - a.head<3>();
+    const Eigen::Vector3d B = c.head<3>() - a.head<3>();
     return 0.5 * A.cross(B).norm();
   }
 }
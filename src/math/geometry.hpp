@@ -140,9 +140,9 @@ static bool parallel(
  * clockwise ordering, otherwise positive.
  */
 double triangleArea(
-    const Eigen::VectorXd &a,
-    const Eigen::VectorXd &b,
-    const Eigen::VectorXd &c);
+    const Eigen::Ref<const Eigen::VectorXd> &a,
+    const Eigen::Ref<const Eigen::VectorXd> &b,
+    const Eigen::Ref<const Eigen::VectorXd> &c);
 
 /// Computes the (unsigned) area of a triangle in 3D.
 double tetraVolume(
@@ -13,7 +13,7 @@ Edge::Edge(
     int     id)
     : _vertices({&vertexOne, &vertexTwo}),
       _id(id),
-      _normal(Eigen::VectorXd::Constant(vertexOne.getDimensions(), 0.0))
+      _normal(Vertex::RawCoords::Zero(vertexOne.getDimensions()))
 {
   PRECICE_ASSERT(vertexOne.getDimensions() == vertexTwo.getDimensions(),
                  vertexOne.getDimensions(), vertexTwo.getDimensions());
@@ -30,11 +30,12 @@ double Edge::getLength() const
   return length;
 }
 
-const Eigen::VectorXd Edge::computeNormal(bool flip)
+const Vertex::RawCoords Edge::computeNormal(bool flip)
 {
+  PRECICE_ASSERT(getDimensions() == 2, getDimensions());
   // Compute normal
-  Eigen::VectorXd edgeVector = vertex(1).getCoords() - vertex(0).getCoords();
-  Eigen::VectorXd normal     = Eigen::Vector2d(-edgeVector[1], edgeVector[0]);
+  const Eigen::Vector2d edgeVector = vertex(1).getCoords() - vertex(0).getCoords();
+  Eigen::Vector2d       normal(-edgeVector[1], edgeVector[0]);
   if (not flip) {
     normal *= -1.0; // Invert direction if counterclockwise
   }
@@ -43,7 +44,7 @@ const Eigen::VectorXd Edge::computeNormal(bool flip)
   return normal * getEnclosingRadius() * 2.0; // Weight by length
 }
 
-const Eigen::VectorXd Edge::getCenter() const
+const Vertex::RawCoords Edge::getCenter() const
 {
   return 0.5 * (_vertices[0]->getCoords() + _vertices[1]->getCoords());
 }
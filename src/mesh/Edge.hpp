@@ -44,7 +44,7 @@ public:
   void setNormal(const VECTOR_T &normal);
 
   /// Computes and sets the normal of the edge, returns the area-weighted normal.
-  const Eigen::VectorXd computeNormal(bool flip = false);
+  const Vertex::RawCoords computeNormal(bool flip = false);
 
   /// Returns the (among edges) unique ID of the edge.
   int getID() const;
@@ -53,10 +53,10 @@ public:
   double getLength() const;
 
   /// Returns the normal of the edge.
-  const Eigen::VectorXd &getNormal() const;
+  const Vertex::RawCoords &getNormal() const;
 
   /// Returns the center of the edge.
-  const Eigen::VectorXd getCenter() const;
+  const Vertex::RawCoords getCenter() const;
 
   /// Returns the radius of the enclosing circle of the edge.
   double getEnclosingRadius() const;
@@ -82,8 +82,8 @@ private:
   /// Unique (among edges) ID of the edge.
   int _id;
 
-  /// Normal of the edge.
-  Eigen::VectorXd _normal;
+  /// Normal of the edge, stored inline like the vertex coordinates.
+  Vertex::RawCoords _normal;
 };
 
 // ------------------------------------------------------ HEADER IMPLEMENTATION
@@ -116,7 +116,7 @@ void Edge::setNormal(
   _normal = normal;
 }
 
-inline const Eigen::VectorXd &Edge::getNormal() const
+inline const Vertex::RawCoords &Edge::getNormal() const
 {
   return _normal;
 }
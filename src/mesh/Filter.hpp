@@ -1,61 +1,75 @@
 #pragma once
 
-#include <boost/container/flat_map.hpp>
+#include <cstddef>
+#include <vector>
 #include "mesh/Mesh.hpp"
+#include "utils/Threads.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice {
 namespace mesh {
 
 /** filters the source Mesh and adds it to the destination Mesh
+ *
+ * The predicate is evaluated for all vertices first, possibly in parallel using utils::parallelFor().
+ * The source elements are then remapped to the created elements using arrays indexed by the element IDs.
+ *
  * @param[inout] destination the destination mesh to append the filtered Mesh to
  * @param[in] source the source Mesh to filter
- * @param[in] p the filter as a UnaryPredicate on mesh::Vertex 
+ * @param[in] p the filter as a UnaryPredicate on mesh::Vertex, which has to be safe to call concurrently
  */
 template <typename UnaryPredicate>
 void filterMesh(Mesh &destination, const Mesh &source, UnaryPredicate p)
 {
-  // Create a flat_map which can contain all vertices of the original mesh.
-  // This prevents resizes during the map build-up.
-  boost::container::flat_map<int, Vertex *> vertexMap;
-  vertexMap.reserve(source.vertices().size());
+  // Smaller meshes are not worth the thread overhead
+  constexpr std::size_t minVerticesPerThread = 1024;
 
-  for (const Vertex &vertex : source.vertices()) {
-    if (p(vertex)) {
-      Vertex &v = destination.createVertex(vertex.getCoords());
+  const auto &vertices = source.vertices();
+
+  // Evaluate the predicate, char instead of bool allows concurrent writes
+  std::vector<char> selected(vertices.size());
+  utils::parallelFor(vertices.size(), minVerticesPerThread, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      selected[i] = p(vertices[i]);
+    }
+  });
+
+  // Maps the vertex IDs of the source to the created vertices, nullptr if filtered out
+  std::vector<Vertex *> vertexMap(vertices.size(), nullptr);
+  for (std::size_t i = 0; i < vertices.size(); ++i) {
+    if (selected[i]) {
+      const Vertex &vertex = vertices[i];
+      Vertex &      v      = destination.createVertex(vertex.getCoords());
       v.setGlobalIndex(vertex.getGlobalIndex());
       if (vertex.isTagged())
         v.tag();
       v.setOwner(vertex.isOwner());
+      PRECICE_ASSERT(source.isValidVertexID(vertex.getID()), vertex.getID());
       vertexMap[vertex.getID()] = &v;
     }
   }
 
-  // Create a flat_map which can contain all edges of the original mesh.
-  // This prevents resizes during the map build-up.
-  boost::container::flat_map<int, Edge *> edgeMap;
-  edgeMap.reserve(source.edges().size());
+  // Maps the edge IDs of the source to the created edges, nullptr if filtered out
+  std::vector<Edge *> edgeMap(source.edges().size(), nullptr);
 
   // Add all edges formed by the contributing vertices
   for (const Edge &edge : source.edges()) {
-    int vertexIndex1 = edge.vertex(0).getID();
-    int vertexIndex2 = edge.vertex(1).getID();
-    if (vertexMap.count(vertexIndex1) == 1 &&
-        vertexMap.count(vertexIndex2) == 1) {
-      Edge &e               = destination.createEdge(*vertexMap[vertexIndex1], *vertexMap[vertexIndex2]);
-      edgeMap[edge.getID()] = &e;
+    Vertex *v1 = vertexMap[edge.vertex(0).getID()];
+    Vertex *v2 = vertexMap[edge.vertex(1).getID()];
+    if (v1 && v2) {
+      PRECICE_ASSERT(source.isValidEdgeID(edge.getID()), edge.getID());
+      edgeMap[edge.getID()] = &destination.createEdge(*v1, *v2);
     }
   }
 
   // Add all triangles formed by the contributing edges
   if (source.getDimensions() == 3) {
     for (const Triangle &triangle : source.triangles()) {
-      int edgeIndex1 = triangle.edge(0).getID();
-      int edgeIndex2 = triangle.edge(1).getID();
-      int edgeIndex3 = triangle.edge(2).getID();
-      if (edgeMap.count(edgeIndex1) == 1 &&
-          edgeMap.count(edgeIndex2) == 1 &&
-          edgeMap.count(edgeIndex3) == 1) {
-        destination.createTriangle(*edgeMap[edgeIndex1], *edgeMap[edgeIndex2], *edgeMap[edgeIndex3]);
+      Edge *e1 = edgeMap[triangle.edge(0).getID()];
+      Edge *e2 = edgeMap[triangle.edge(1).getID()];
+      Edge *e3 = edgeMap[triangle.edge(2).getID()];
+      if (e1 && e2 && e3) {
+        destination.createTriangle(*e1, *e2, *e3);
       }
     }
   }
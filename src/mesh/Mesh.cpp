@@ -5,6 +5,7 @@
 #include <boost/container/flat_map.hpp>
 #include <functional>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <type_traits>
 #include <utility>
@@ -16,10 +17,58 @@
 #include "mesh/Data.hpp"
 #include "query/Index.hpp"
 #include "utils/EigenHelperFunctions.hpp"
+#include "utils/Threads.hpp"
 
 namespace precice {
 namespace mesh {
 
+namespace {
+/// Minimal number of elements per thread in computeState(), smaller meshes are not worth the thread overhead
+constexpr size_t minElementsPerThread = 1024;
+
+/** Adds the weighted normals of the adjacent faces to the normal of every element and normalizes it.
+ *
+ * adjacentIDs(face) returns the IDs of the elements adjacent to a face.
+ * The adjacency is inverted first, such that every element gathers its normal without conflicts.
+ * The faces are summed up in ascending order, hence, the result does not depend on the number of threads.
+ */
+template <typename Elements, typename AdjacentIDs>
+void gatherNormals(Elements &elements, const std::vector<Vertex::RawCoords> &weightedNormals, AdjacentIDs adjacentIDs)
+{
+  const size_t size = elements.size();
+
+  // Invert the adjacency to compressed row storage
+  std::vector<size_t> offsets(size + 1, 0);
+  for (size_t face = 0; face < weightedNormals.size(); ++face) {
+    for (int id : adjacentIDs(face)) {
+      PRECICE_ASSERT(id >= 0 && static_cast<size_t>(id) < size, id, size);
+      ++offsets[id + 1];
+    }
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  std::vector<size_t> faces(offsets.back());
+  std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+  for (size_t face = 0; face < weightedNormals.size(); ++face) {
+    for (int id : adjacentIDs(face)) {
+      faces[next[id]++] = face;
+    }
+  }
+
+  utils::parallelFor(size, minElementsPerThread, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      auto &            element = elements[i];
+      const int         id      = element.getID();
+      Vertex::RawCoords normal  = element.getNormal();
+      for (size_t j = offsets[id]; j < offsets[id + 1]; ++j) {
+        normal += weightedNormals[faces[j]];
+      }
+      // there can be cases when an element has no adjacent face though faces exist in general (e.g. after filtering)
+      element.setNormal(normal.normalized());
+    }
+  });
+}
+} // namespace
+
 Mesh::Mesh(
     const std::string &name,
     int                dimensions,
@@ -34,7 +83,6 @@ Mesh::Mesh(
   PRECICE_ASSERT((_dimensions == 2) || (_dimensions == 3), _dimensions);
   PRECICE_ASSERT(_name != std::string(""));
 
-  meshChanged.connect([](Mesh &m) { query::clearCache(m); });
   meshDestroyed.connect([](Mesh &m) { query::clearCache(m); });
 }
 
@@ -228,48 +276,45 @@ void Mesh::computeState()
 
   // Compute (in 2D) edge normals
   if (_dimensions == 2) {
-    for (Edge &edge : _edges) {
-      Eigen::VectorXd weightednormal = edge.computeNormal(_flipNormals);
-
-      // Accumulate normal in associated vertices
-      for (int i = 0; i < 2; i++) {
-        Eigen::VectorXd vertexNormal = edge.vertex(i).getNormal();
-        vertexNormal += weightednormal;
-        edge.vertex(i).setNormal(vertexNormal);
+    std::vector<Vertex::RawCoords> weightedNormals(size2DFaces);
+    utils::parallelFor(size2DFaces, minElementsPerThread, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        weightedNormals[i] = _edges[i].computeNormal(_flipNormals);
       }
-    }
+    });
+
+    // Accumulate normal in associated vertices
+    gatherNormals(_vertices, weightedNormals, [this](size_t i) {
+      const Edge &edge = _edges[i];
+      return std::array<int, 2>{edge.vertex(0).getID(), edge.vertex(1).getID()};
+    });
   }
 
   if (_dimensions == 3) {
     // Compute normals
-    for (Triangle &triangle : _triangles) {
-      PRECICE_ASSERT(triangle.vertex(0) != triangle.vertex(1),
-                     triangle.vertex(0), triangle.getID());
-      PRECICE_ASSERT(triangle.vertex(1) != triangle.vertex(2),
-                     triangle.vertex(1), triangle.getID());
-      PRECICE_ASSERT(triangle.vertex(2) != triangle.vertex(0),
-                     triangle.vertex(2), triangle.getID());
-
-      // Compute normals
-      Eigen::VectorXd weightednormal = triangle.computeNormal(_flipNormals);
-
-      // Accumulate area-weighted normal in associated vertices and edges
-      for (int i = 0; i < 3; i++) {
-        triangle.edge(i).setNormal(triangle.edge(i).getNormal() + weightednormal);
-        triangle.vertex(i).setNormal(triangle.vertex(i).getNormal() + weightednormal);
+    std::vector<Vertex::RawCoords> weightedNormals(size3DFaces);
+    utils::parallelFor(size3DFaces, minElementsPerThread, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        Triangle &triangle = _triangles[i];
+        PRECICE_ASSERT(triangle.vertex(0) != triangle.vertex(1),
+                       triangle.vertex(0), triangle.getID());
+        PRECICE_ASSERT(triangle.vertex(1) != triangle.vertex(2),
+                       triangle.vertex(1), triangle.getID());
+        PRECICE_ASSERT(triangle.vertex(2) != triangle.vertex(0),
+                       triangle.vertex(2), triangle.getID());
+        weightedNormals[i] = triangle.computeNormal(_flipNormals);
       }
-    }
-
-    // Normalize edge normals (only done in 3D)
-    for (Edge &edge : _edges) {
-      // there can be cases when an edge has no adjacent triangle though triangles exist in general (e.g. after filtering)
-      edge.setNormal(edge.getNormal().normalized());
-    }
-  }
-
-  for (Vertex &vertex : _vertices) {
-    // there can be cases when a vertex has no edge though edges exist in general (e.g. after filtering)
-    vertex.setNormal(vertex.getNormal().normalized());
+    });
+
+    // Accumulate area-weighted normal in associated edges and vertices
+    gatherNormals(_edges, weightedNormals, [this](size_t i) {
+      const Triangle &triangle = _triangles[i];
+      return std::array<int, 3>{triangle.edge(0).getID(), triangle.edge(1).getID(), triangle.edge(2).getID()};
+    });
+    gatherNormals(_vertices, weightedNormals, [this](size_t i) {
+      const Triangle &triangle = _triangles[i];
+      return std::array<int, 3>{triangle.vertex(0).getID(), triangle.vertex(1).getID(), triangle.vertex(2).getID()};
+    });
   }
 }
 
@@ -360,10 +405,8 @@ void Mesh::addMesh(
 
   boost::container::flat_map<int, Vertex *> vertexMap;
   vertexMap.reserve(deltaMesh.vertices().size());
-  Eigen::VectorXd coords(_dimensions);
   for (const Vertex &vertex : deltaMesh.vertices()) {
-    coords    = vertex.getCoords();
-    Vertex &v = createVertex(coords);
+    Vertex &v = createVertex(vertex.getCoords());
     v.setGlobalIndex(vertex.getGlobalIndex());
     if (vertex.isTagged())
       v.tag();
@@ -168,6 +168,10 @@ public:
    * normalization of the vertex normals.
    *
    * Circumcircles of edges and triangles are computed.
+   *
+   * The face normals and their accumulation into vertices (and edges in 3d) are
+   * computed in parallel using utils::parallelFor(). The result does not depend
+   * on the number of threads.
    */
   void computeState();
 
@@ -25,7 +25,7 @@ Triangle::Triangle(
     int   id)
     : _edges({&edgeOne, &edgeTwo, &edgeThree}),
       _id(id),
-      _normal(Eigen::VectorXd::Zero(edgeOne.getDimensions()))
+      _normal(Vertex::RawCoords::Zero(edgeOne.getDimensions()))
 {
   PRECICE_ASSERT(edgeOne.getDimensions() == edgeTwo.getDimensions(),
                  edgeOne.getDimensions(), edgeTwo.getDimensions());
@@ -84,12 +84,12 @@ double Triangle::getArea() const
   return (0.5 * normal.norm());
 }
 
-const Eigen::VectorXd Triangle::computeNormal(bool flip)
+const Vertex::RawCoords Triangle::computeNormal(bool flip)
 {
-  Eigen::Vector3d vectorA = edge(1).getCenter() - edge(0).getCenter();
-  Eigen::Vector3d vectorB = edge(2).getCenter() - edge(0).getCenter();
+  const Eigen::Vector3d vectorA = edge(1).getCenter() - edge(0).getCenter();
+  const Eigen::Vector3d vectorB = edge(2).getCenter() - edge(0).getCenter();
   // Compute cross-product of vector A and vector B
-  auto normal = vectorA.cross(vectorB);
+  Eigen::Vector3d normal = vectorA.cross(vectorB);
   if (flip) {
     normal *= -1.0; // Invert direction if counterclockwise
   }
@@ -102,12 +102,12 @@ int Triangle::getDimensions() const
   return _edges[0]->getDimensions();
 }
 
-const Eigen::VectorXd &Triangle::getNormal() const
+const Vertex::RawCoords &Triangle::getNormal() const
 {
   return _normal;
 }
 
-const Eigen::VectorXd Triangle::getCenter() const
+const Vertex::RawCoords Triangle::getCenter() const
 {
   return (_edges[0]->getCenter() + _edges[1]->getCenter() + _edges[2]->getCenter()) / 3.0;
 }
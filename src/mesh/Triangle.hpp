@@ -29,13 +29,13 @@ public:
    * The returned value is the forwarded result of Vertex::getCoords.
    * It is thus a read-only random-access iterator.
    */
-  using const_iterator = IndexRangeIterator<const Triangle, const Eigen::VectorXd>;
+  using const_iterator = IndexRangeIterator<const Triangle, const Vertex::RawCoords>;
 
   /// Type of the read-only random access vertex iterator
   using iterator = const_iterator;
 
   /// Fix for the Boost.Test versions 1.65.1 - 1.67
-  using value_type = Eigen::VectorXd;
+  using value_type = Vertex::RawCoords;
 
   /// Constructor, the order of edges defines the outer normal direction.
   Triangle(
@@ -99,7 +99,7 @@ public:
   void setNormal(const VECTOR_T &normal);
 
   /// Computes and sets the normal of the triangle, returns the area-weighted normal.
-  const Eigen::VectorXd computeNormal(bool flip = false);
+  const Vertex::RawCoords computeNormal(bool flip = false);
 
   /// Returns a among triangles globally unique ID.
   int getID() const;
@@ -112,10 +112,10 @@ public:
    *
    * @pre The normal has to be computed and set from outside before.
    */
-  const Eigen::VectorXd &getNormal() const;
+  const Vertex::RawCoords &getNormal() const;
 
   /// Returns the barycenter of the triangle.
-  const Eigen::VectorXd getCenter() const;
+  const Vertex::RawCoords getCenter() const;
 
   /// Returns the radius of the circle enclosing the triangle.
   double getEnclosingRadius() const;
@@ -141,8 +141,8 @@ private:
   /// ID of the edge.
   int _id;
 
-  /// Normal vector of the triangle.
-  Eigen::VectorXd _normal;
+  /// Normal vector of the triangle, stored inline like the vertex coordinates.
+  Vertex::RawCoords _normal;
 };
 
 // --------------------------------------------------------- HEADER DEFINITIONS
@@ -12,6 +12,14 @@ namespace mesh {
 /// Vertex of a mesh.
 class Vertex {
 public:
+  /**
+   * @brief Storage type of coordinates and normals.
+   *
+   * The size is dynamic, but bounded by 3. This keeps the data inside the Vertex
+   * and avoids two heap allocations per vertex.
+   */
+  using RawCoords = Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, 3, 1>;
+
   /// Constructor for vertex
   template <typename VECTOR_T>
   Vertex(
@@ -41,10 +49,10 @@ public:
   int getID() const;
 
   /// Returns the coordinates of the vertex.
-  const Eigen::VectorXd &getCoords() const;
+  const RawCoords &getCoords() const;
 
   /// Returns the normal of the vertex.
-  const Eigen::VectorXd &getNormal() const;
+  const RawCoords &getNormal() const;
 
   /// Globally unique index
   int getGlobalIndex() const;
@@ -68,10 +76,10 @@ private:
   int _id;
 
   /// Coordinates of the vertex.
-  Eigen::VectorXd _coords;
+  RawCoords _coords;
 
   /// Normal of the vertex.
-  Eigen::VectorXd _normal;
+  RawCoords _normal;
 
   /// global (unique) index for parallel simulations
   int _globalIndex = -1;
@@ -91,7 +99,7 @@ Vertex::Vertex(
     int             id)
     : _id(id),
       _coords(coordinates),
-      _normal(Eigen::VectorXd::Constant(_coords.size(), 0.0))
+      _normal(RawCoords::Zero(_coords.size()))
 {
 }
 
@@ -132,7 +140,7 @@ inline int Vertex::getID() const
   return _id;
 }
 
-inline const Eigen::VectorXd &Vertex::getCoords() const
+inline const Vertex::RawCoords &Vertex::getCoords() const
 {
   return _coords;
 }
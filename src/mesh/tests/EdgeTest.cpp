@@ -1,6 +1,7 @@
 #include <Eigen/Core>
 #include <iosfwd>
 #include <string>
+#include <utility>
 #include "logging/Logger.hpp"
 #include "mesh/Edge.hpp"
 #include "mesh/Vertex.hpp"
@@ -81,5 +82,29 @@ BOOST_AUTO_TEST_CASE(EdgeConnectedTo)
   BOOST_TEST(edge3.connectedTo(edge2));
 }
 
+BOOST_AUTO_TEST_CASE(EdgeCopyAndMove)
+{
+  PRECICE_TEST(1_rank);
+  Vertex v1(Eigen::Vector2d(0., 0.), 0);
+  Vertex v2(Eigen::Vector2d(1., 0.), 1);
+  Edge   edge(v1, v2, 0);
+  BOOST_TEST(testing::equals(edge.computeNormal(), Eigen::Vector2d(0., -1.)));
+
+  Edge copy(edge);
+  BOOST_TEST(copy.getID() == 0);
+  BOOST_TEST(testing::equals(copy.getNormal(), Eigen::Vector2d(0., -1.)));
+  BOOST_TEST(testing::equals(copy.vertex(0).getCoords(), Eigen::Vector2d(0., 0.)));
+  BOOST_TEST(testing::equals(copy.vertex(1).getCoords(), Eigen::Vector2d(1., 0.)));
+
+  // Recomputing the normal of the original does not affect the copy
+  v2.setCoords(Eigen::Vector2d(0., 1.));
+  BOOST_TEST(testing::equals(edge.computeNormal(), Eigen::Vector2d(1., 0.)));
+  BOOST_TEST(testing::equals(copy.getNormal(), Eigen::Vector2d(0., -1.)));
+
+  Edge moved(std::move(copy));
+  BOOST_TEST(testing::equals(moved.getNormal(), Eigen::Vector2d(0., -1.)));
+  BOOST_TEST(testing::equals(moved.getCenter(), Eigen::Vector2d(0., 0.5)));
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Edge
 BOOST_AUTO_TEST_SUITE_END() // Mesh
@@ -10,6 +10,7 @@
 #include "mesh/BoundingBox.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Edge.hpp"
+#include "mesh/Filter.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "mesh/Triangle.hpp"
@@ -17,6 +18,7 @@
 #include "mesh/Vertex.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
+#include "utils/Threads.hpp"
 #include "utils/algorithm.hpp"
 
 using namespace precice;
@@ -432,6 +434,96 @@ BOOST_AUTO_TEST_CASE(ComputeStateOfNotFullyConnectedMesh)
   }
 }
 
+BOOST_AUTO_TEST_CASE(ComputeStateIndependentOfThreads)
+{
+  PRECICE_TEST(1_rank);
+  // Creates a curved grid of triangles, which is large enough to be split across threads
+  auto createGrid = [] {
+    PtrMesh   mesh(new Mesh("Grid", 3, false, testing::nextMeshID()));
+    const int n = 40;
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        mesh->createVertex(Eigen::Vector3d(i, j, 0.01 * i * j));
+      }
+    }
+    auto &vertices = mesh->vertices();
+    for (int i = 0; i + 1 < n; ++i) {
+      for (int j = 0; j + 1 < n; ++j) {
+        Vertex &v0 = vertices[i * n + j];
+        Vertex &v1 = vertices[(i + 1) * n + j];
+        Vertex &v2 = vertices[i * n + j + 1];
+        Vertex &v3 = vertices[(i + 1) * n + j + 1];
+        Edge &  e0 = mesh->createUniqueEdge(v0, v1);
+        Edge &  e1 = mesh->createUniqueEdge(v1, v2);
+        Edge &  e2 = mesh->createUniqueEdge(v2, v0);
+        Edge &  e3 = mesh->createUniqueEdge(v1, v3);
+        Edge &  e4 = mesh->createUniqueEdge(v3, v2);
+        mesh->createTriangle(e0, e1, e2);
+        mesh->createTriangle(e3, e4, e1);
+      }
+    }
+    return mesh;
+  };
+
+  auto serial = createGrid();
+  serial->computeState();
+
+  auto parallel = createGrid();
+  {
+    utils::ScopedThreadCount threadCount(4);
+    parallel->computeState();
+  }
+
+  BOOST_TEST(serial->triangles().size() > 3000);
+  for (size_t i = 0; i < serial->vertices().size(); ++i) {
+    BOOST_TEST(serial->vertices()[i].getNormal() == parallel->vertices()[i].getNormal());
+    BOOST_TEST(math::equals(serial->vertices()[i].getNormal().norm(), 1.0));
+  }
+  for (size_t i = 0; i < serial->edges().size(); ++i) {
+    BOOST_TEST(serial->edges()[i].getNormal() == parallel->edges()[i].getNormal());
+  }
+  for (size_t i = 0; i < serial->triangles().size(); ++i) {
+    BOOST_TEST(serial->triangles()[i].getNormal() == parallel->triangles()[i].getNormal());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(FilterMesh)
+{
+  PRECICE_TEST(1_rank);
+  Mesh    source("Source", 3, false, testing::nextMeshID());
+  Vertex &v0 = source.createVertex(Eigen::Vector3d(0.0, 0.0, 0.0));
+  Vertex &v1 = source.createVertex(Eigen::Vector3d(1.0, 0.0, 0.0));
+  Vertex &v2 = source.createVertex(Eigen::Vector3d(0.0, 1.0, 0.0));
+  Vertex &v3 = source.createVertex(Eigen::Vector3d(1.0, 1.0, 0.0));
+  v1.setGlobalIndex(11);
+  v2.setOwner(false);
+  v2.tag();
+  Edge &e0 = source.createEdge(v0, v1);
+  Edge &e1 = source.createEdge(v1, v2);
+  Edge &e2 = source.createEdge(v2, v0);
+  Edge &e3 = source.createEdge(v1, v3);
+  Edge &e4 = source.createEdge(v3, v2);
+  source.createTriangle(e0, e1, e2);
+  source.createTriangle(e3, e4, e1);
+
+  // Filters out v3, hence e3, e4 and the second triangle
+  Mesh destination("Destination", 3, false, testing::nextMeshID());
+  filterMesh(destination, source, [](const Vertex &v) { return v.getCoords()[0] + v.getCoords()[1] < 1.5; });
+  BOOST_TEST(destination.vertices().size() == 3);
+  BOOST_TEST(destination.edges().size() == 3);
+  BOOST_TEST(destination.triangles().size() == 1);
+  BOOST_TEST(destination.vertices()[1].getGlobalIndex() == 11);
+  BOOST_TEST(not destination.vertices()[2].isOwner());
+  BOOST_TEST(destination.vertices()[2].isTagged());
+  BOOST_TEST(destination.triangles()[0].vertex(2).getCoords() == v2.getCoords());
+
+  // Filtering appends to the destination
+  filterMesh(destination, source, [](const Vertex &v) { return v.getCoords()[0] > 0.5; });
+  BOOST_TEST(destination.vertices().size() == 5);
+  BOOST_TEST(destination.edges().size() == 4);
+  BOOST_TEST(destination.triangles().size() == 1);
+}
+
 BOOST_AUTO_TEST_CASE(ResizeDataGrow)
 {
   PRECICE_TEST(1_rank);
@@ -1,6 +1,7 @@
 #include <Eigen/Core>
 #include <iosfwd>
 #include <string>
+#include <utility>
 #include "logging/Logger.hpp"
 #include "mesh/Vertex.hpp"
 #include "testing/TestContext.hpp"
@@ -55,5 +56,29 @@ BOOST_AUTO_TEST_CASE(VertexWKTPrint)
   BOOST_TEST(v2str == v2stream.str());
 }
 
+BOOST_AUTO_TEST_CASE(VertexCopyAndMove)
+{
+  PRECICE_TEST(1_rank);
+  using namespace mesh;
+  Vertex v(Eigen::Vector3d(1., 2., 3.), 5);
+  v.setNormal(Eigen::Vector3d(0., 0., 1.));
+
+  Vertex copy(v);
+  v.setCoords(Eigen::Vector3d(4., 5., 6.));
+  v.setNormal(Eigen::Vector3d(1., 0., 0.));
+  BOOST_TEST(copy.getID() == 5);
+  BOOST_TEST(testing::equals(copy.getCoords(), Eigen::Vector3d(1., 2., 3.)));
+  BOOST_TEST(testing::equals(copy.getNormal(), Eigen::Vector3d(0., 0., 1.)));
+
+  Vertex moved(std::move(copy));
+  BOOST_TEST(moved.getDimensions() == 3);
+  BOOST_TEST(testing::equals(moved.getCoords(), Eigen::Vector3d(1., 2., 3.)));
+  BOOST_TEST(testing::equals(moved.getNormal(), Eigen::Vector3d(0., 0., 1.)));
+
+  moved = v;
+  BOOST_TEST(testing::equals(moved.getCoords(), Eigen::Vector3d(4., 5., 6.)));
+  BOOST_TEST(testing::equals(moved.getNormal(), Eigen::Vector3d(1., 0., 0.)));
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Vertex
 BOOST_AUTO_TEST_SUITE_END() // Mesh
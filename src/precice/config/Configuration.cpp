@@ -1,5 +1,6 @@
 #include "Configuration.hpp"
 #include "logging/LogMacros.hpp"
+#include "utils/Threads.hpp"
 #include "xml/XMLAttribute.hpp"
 
 namespace precice {
@@ -25,6 +26,10 @@ Configuration::Configuration()
   auto attrSyncMode = xml::makeXMLAttribute("sync-mode", false)
                           .setDocumentation("sync-mode enabled additional inter- and intra-participant synchronizations");
   _tag.addAttribute(attrSyncMode);
+
+  auto attrThreads = xml::makeXMLAttribute("threads", 1)
+                         .setDocumentation("Number of threads used per rank for the setup and evaluation of mappings. Use 0 to use all hardware threads.");
+  _tag.addAttribute(attrThreads);
 }
 
 xml::XMLTag &Configuration::getXMLTag()
@@ -37,6 +42,9 @@ void Configuration::xmlTagCallback(const xml::ConfigurationContext &context, xml
   PRECICE_TRACE(tag.getName());
   if (tag.getName() == "precice-configuration") {
     precice::syncMode = tag.getBooleanAttributeValue("sync-mode");
+    const int threads = tag.getIntAttributeValue("threads");
+    PRECICE_CHECK(threads >= 0, "The number of threads has to be 0 (all hardware threads) or positive, but is " << threads << ".");
+    utils::setThreadCount(threads);
   }
 }
 
@@ -53,6 +53,7 @@
 #include "precice/impl/WatchIntegral.hpp"
 #include "precice/impl/WatchPoint.hpp"
 #include "precice/impl/versions.hpp"
+#include "query/Index.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/EigenIO.hpp"
 #include "utils/Event.hpp"
@@ -62,6 +63,7 @@
 #include "utils/Parallel.hpp"
 #include "utils/Petsc.hpp"
 #include "utils/PointerVector.hpp"
+#include "utils/Threads.hpp"
 #include "utils/algorithm.hpp"
 #include "utils/assertion.hpp"
 #include "xml/XMLTag.hpp"
@@ -706,8 +708,7 @@ void SolverInterfaceImpl::setMeshVertices(
   const Eigen::Map<const Eigen::MatrixXd> posMatrix{
       positions, _dimensions, static_cast<EIGEN_DEFAULT_DENSE_INDEX_TYPE>(size)};
   for (int i = 0; i < size; ++i) {
-    Eigen::VectorXd current(posMatrix.col(i));
-    ids[i] = mesh->createVertex(current).getID();
+    ids[i] = mesh->createVertex(posMatrix.col(i)).getID();
   }
   mesh->allocateDataValues();
 }
@@ -749,11 +750,19 @@ void SolverInterfaceImpl::getMeshVertexIDsFromPositions(
   Eigen::Map<const Eigen::MatrixXd> posMatrix{
       positions, _dimensions, static_cast<EIGEN_DEFAULT_DENSE_INDEX_TYPE>(size)};
   const auto vsize = vertices.size();
+  // The vertex tree of the mesh is built on first use and cached by the query module
+  query::Index index(mesh);
   for (size_t i = 0; i < size; i++) {
-    size_t j = 0;
-    for (; j < vsize; j++) {
-      if (math::equals(posMatrix.col(i), vertices[j].getCoords())) {
-        break;
+    // math::equals compares relative to the norm of the smaller vector, hence every
+    // match lies within this radius around the queried position.
+    const mesh::Vertex position(posMatrix.col(i), -1);
+    const double       radius = 2 * math::NUMERICAL_ZERO_DIFFERENCE * posMatrix.col(i).norm();
+
+    // Return the first matching vertex to keep the result independent of the tree layout
+    size_t j = vsize;
+    for (size_t candidate : index.getVerticesInsideBox(position, radius)) {
+      if (candidate < j && math::equals(posMatrix.col(i), vertices[candidate].getCoords())) {
+        j = candidate;
       }
     }
     if (j == vsize) {
@@ -998,6 +1007,7 @@ void SolverInterfaceImpl::mapWriteDataFrom(
       PRECICE_DEBUG("Compute mapping from mesh \"" << context.mesh->getName() << "\"");
       mappingContext.mapping->computeMapping();
     }
+    mapping::Mapping::DataIDPairs dataIDs;
     for (impl::DataContext &context : _accessor->writeDataContexts()) {
 
       if (context.mesh->getID() != fromMeshID) {
@@ -1008,8 +1018,9 @@ void SolverInterfaceImpl::mapWriteDataFrom(
       PRECICE_DEBUG("Map data \"" << context.fromData->getName()
                                   << "\" from mesh \"" << context.mesh->getName() << "\"");
       PRECICE_ASSERT(mappingContext.mapping == context.mappingContext.mapping);
-      mappingContext.mapping->map(context.fromData->getID(), context.toData->getID());
+      dataIDs.emplace_back(context.fromData->getID(), context.toData->getID());
     }
+    mappingContext.mapping->mapBatch(dataIDs);
     mappingContext.hasMappedData = true;
   }
   performDataActions({action::Action::WRITE_MAPPING_POST}, time, 0, 0, 0);
@@ -1036,6 +1047,7 @@ void SolverInterfaceImpl::mapReadDataTo(
       PRECICE_DEBUG("Compute mapping from mesh \"" << context.mesh->getName() << "\"");
       mappingContext.mapping->computeMapping();
     }
+    mapping::Mapping::DataIDPairs dataIDs;
     for (impl::DataContext &context : _accessor->readDataContexts()) {
       if (context.mesh->getID() != toMeshID) {
         continue;
@@ -1044,9 +1056,9 @@ void SolverInterfaceImpl::mapReadDataTo(
       PRECICE_DEBUG("Map data \"" << context.fromData->getName()
                                   << "\" to mesh \"" << context.mesh->getName() << "\"");
       PRECICE_ASSERT(mappingContext.mapping == context.mappingContext.mapping);
-      mappingContext.mapping->map(context.fromData->getID(), context.toData->getID());
-      PRECICE_DEBUG("Mapped values = " << utils::previewRange(3, context.toData->values()));
+      dataIDs.emplace_back(context.fromData->getID(), context.toData->getID());
     }
+    mappingContext.mapping->mapBatch(dataIDs);
     mappingContext.hasMappedData = true;
   }
   performDataActions({action::Action::READ_MAPPING_POST}, time, 0, 0, 0);
@@ -1483,24 +1495,30 @@ void SolverInterfaceImpl::mapWrittenData()
     }
   }
 
-  // Map data
-  for (impl::DataContext &context : _accessor->writeDataContexts()) {
-    timing          = context.mappingContext.timing;
-    bool hasMapping = context.mappingContext.mapping.get() != nullptr;
-    bool rightTime  = timing == MappingConfiguration::ON_ADVANCE;
-    rightTime |= timing == MappingConfiguration::INITIAL;
-    bool hasMapped = context.mappingContext.hasMappedData;
-    if (hasMapping && rightTime && (not hasMapped)) {
-      int inDataID  = context.fromData->getID();
-      int outDataID = context.toData->getID();
-      PRECICE_DEBUG("Map data \"" << context.fromData->getName()
-                                  << "\" from mesh \"" << context.mesh->getName() << "\"");
-      context.toData->values() = Eigen::VectorXd::Zero(context.toData->values().size());
-      PRECICE_DEBUG("Map from dataID " << inDataID << " to dataID: " << outDataID);
-      context.mappingContext.mapping->map(inDataID, outDataID);
-      PRECICE_DEBUG("Mapped values = " << utils::previewRange(3, context.toData->values()));
+  // Map data, all data using the same mapping at once
+  std::vector<MappingTask> tasks;
+  for (impl::MappingContext &mappingContext : _accessor->writeMappingContexts()) {
+    Mapping::DataIDPairs dataIDs;
+    for (impl::DataContext &context : _accessor->writeDataContexts()) {
+      timing         = context.mappingContext.timing;
+      bool rightTime = timing == MappingConfiguration::ON_ADVANCE;
+      rightTime |= timing == MappingConfiguration::INITIAL;
+      bool hasMapped = context.mappingContext.hasMappedData;
+      if (context.mappingContext.mapping == mappingContext.mapping && rightTime && (not hasMapped)) {
+        int inDataID  = context.fromData->getID();
+        int outDataID = context.toData->getID();
+        PRECICE_DEBUG("Map data \"" << context.fromData->getName()
+                                    << "\" from mesh \"" << context.mesh->getName() << "\"");
+        context.toData->values() = Eigen::VectorXd::Zero(context.toData->values().size());
+        PRECICE_DEBUG("Map from dataID " << inDataID << " to dataID: " << outDataID);
+        dataIDs.emplace_back(inDataID, outDataID);
+      }
+    }
+    if (not dataIDs.empty()) {
+      tasks.emplace_back(mappingContext.mapping, std::move(dataIDs));
     }
   }
+  performMappings(tasks);
 
   // Clear non-stationary, non-incremental mappings
   for (impl::MappingContext &context : _accessor->writeMappingContexts()) {
@@ -1512,6 +1530,57 @@ void SolverInterfaceImpl::mapWrittenData()
   }
 }
 
+void SolverInterfaceImpl::performMappings(const std::vector<MappingTask> &tasks)
+{
+  PRECICE_TRACE(tasks.size());
+
+  auto perform = [](const MappingTask &task) {
+    // No barrier, as the event may be recorded concurrently
+    Event e("mapping.From" + task.first->getInputMesh()->getName() + "To" + task.first->getOutputMesh()->getName());
+    task.first->mapBatch(task.second);
+  };
+
+  // Barriers of synchronized events cannot be called concurrently
+  const bool concurrent = utils::getThreadCount() > 1 && not precice::syncMode;
+
+  size_t begin = 0;
+  while (begin < tasks.size()) {
+    // Extend the group as long as the mappings are independent.
+    // Mappings may share input data, but no mapping may write data which is read or written by another one.
+    std::set<int> readDataIDs;
+    std::set<int> writtenDataIDs;
+    size_t        end = begin;
+    for (; concurrent && end < tasks.size() && tasks[end].first->canMapConcurrently(); ++end) {
+      const auto &dataIDs   = tasks[end].second;
+      bool        dependent = std::any_of(dataIDs.begin(), dataIDs.end(), [&](const std::pair<int, int> &ids) {
+        return writtenDataIDs.count(ids.first) > 0 || writtenDataIDs.count(ids.second) > 0 || readDataIDs.count(ids.second) > 0;
+      });
+      if (dependent) {
+        break;
+      }
+      for (const auto &ids : dataIDs) {
+        readDataIDs.insert(ids.first);
+        writtenDataIDs.insert(ids.second);
+      }
+    }
+
+    if (end - begin > 1) {
+      PRECICE_DEBUG("Perform " << end - begin << " mappings concurrently");
+      _concurrentMappings += end - begin;
+      // Parallel loops within the mappings run serially on the thread of their mapping
+      utils::parallelFor(end - begin, 1, [&](size_t first, size_t last) {
+        for (size_t i = begin + first; i < begin + last; ++i) {
+          perform(tasks[i]);
+        }
+      });
+    } else {
+      end = begin + 1;
+      perform(tasks[begin]);
+    }
+    begin = end;
+  }
+}
+
 void SolverInterfaceImpl::mapReadData()
 {
   PRECICE_TRACE();
@@ -1533,23 +1602,29 @@ void SolverInterfaceImpl::mapReadData()
     }
   }
 
-  // Map data
-  for (impl::DataContext &context : _accessor->readDataContexts()) {
-    timing      = context.mappingContext.timing;
-    bool mapNow = timing == mapping::MappingConfiguration::ON_ADVANCE;
-    mapNow |= timing == mapping::MappingConfiguration::INITIAL;
-    bool hasMapping = context.mappingContext.mapping.get() != nullptr;
-    bool hasMapped  = context.mappingContext.hasMappedData;
-    if (mapNow && hasMapping && (not hasMapped)) {
-      int inDataID             = context.fromData->getID();
-      int outDataID            = context.toData->getID();
-      context.toData->values() = Eigen::VectorXd::Zero(context.toData->values().size());
-      PRECICE_DEBUG("Map read data \"" << context.fromData->getName()
-                                       << "\" to mesh \"" << context.mesh->getName() << "\"");
-      context.mappingContext.mapping->map(inDataID, outDataID);
-      PRECICE_DEBUG("Mapped values = " << utils::previewRange(3, context.toData->values()));
+  // Map data, all data using the same mapping at once
+  std::vector<MappingTask> tasks;
+  for (impl::MappingContext &mappingContext : _accessor->readMappingContexts()) {
+    mapping::Mapping::DataIDPairs dataIDs;
+    for (impl::DataContext &context : _accessor->readDataContexts()) {
+      timing      = context.mappingContext.timing;
+      bool mapNow = timing == mapping::MappingConfiguration::ON_ADVANCE;
+      mapNow |= timing == mapping::MappingConfiguration::INITIAL;
+      bool hasMapped = context.mappingContext.hasMappedData;
+      if (context.mappingContext.mapping == mappingContext.mapping && mapNow && (not hasMapped)) {
+        int inDataID             = context.fromData->getID();
+        int outDataID            = context.toData->getID();
+        context.toData->values() = Eigen::VectorXd::Zero(context.toData->values().size());
+        PRECICE_DEBUG("Map read data \"" << context.fromData->getName()
+                                         << "\" to mesh \"" << context.mesh->getName() << "\"");
+        dataIDs.emplace_back(inDataID, outDataID);
+      }
+    }
+    if (not dataIDs.empty()) {
+      tasks.emplace_back(mappingContext.mapping, std::move(dataIDs));
     }
   }
+  performMappings(tasks);
   // Clear non-initial, non-incremental mappings
   for (impl::MappingContext &context : _accessor->readMappingContexts()) {
     bool isStationary = context.timing == mapping::MappingConfiguration::INITIAL;
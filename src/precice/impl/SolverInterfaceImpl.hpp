@@ -4,6 +4,7 @@
 #include <set>
 #include <stddef.h>
 #include <string>
+#include <utility>
 #include <vector>
 #include "action/Action.hpp"
 #include "boost/noncopyable.hpp"
@@ -13,6 +14,7 @@
 #include "logging/Logger.hpp"
 #include "m2n/BoundM2N.hpp"
 #include "m2n/config/M2NConfiguration.hpp"
+#include "mapping/Mapping.hpp"
 #include "precice/SolverInterface.hpp"
 #include "precice/impl/DataContext.hpp"
 #include "precice/impl/SharedPointer.hpp"
@@ -521,6 +523,12 @@ public:
   /// Allows to access a registered mesh
   const mesh::Mesh &mesh(const std::string &meshName) const;
 
+  /// Returns the number of mappings which were performed concurrently so far
+  size_t concurrentMappings() const
+  {
+    return _concurrentMappings;
+  }
+
 private:
   mutable logging::Logger _log{"impl::SolverInterfaceImpl"};
 
@@ -550,6 +558,9 @@ private:
 
   cplscheme::PtrCouplingScheme _couplingScheme;
 
+  /// Number of mappings performed concurrently, see performMappings()
+  size_t _concurrentMappings = 0;
+
   /// Represents the various states a SolverInterface can be in.
   enum struct State {
     Constructed, // Initial state of SolverInterface
@@ -634,6 +645,19 @@ private:
   /// Computes, performs, and resets all suitable read mappings.
   void mapReadData();
 
+  /// A computed mapping together with the pairs of data IDs to map
+  using MappingTask = std::pair<mapping::PtrMapping, mapping::Mapping::DataIDPairs>;
+
+  /**
+   * @brief Performs the given mappings, independent mappings run concurrently.
+   *
+   * Consecutive mappings are grouped as long as they can map concurrently and none of them writes
+   * data which is read or written by another mapping of the group. Sharing input data is fine.
+   * The mappings of a group are distributed to the threads configured by utils::setThreadCount().
+   * All other mappings run on their own, which preserves the order of dependent mappings.
+   */
+  void performMappings(const std::vector<MappingTask> &tasks);
+
   /**
    * @brief Performs all data actions with given timing.
    *
@@ -2413,6 +2413,56 @@ BOOST_AUTO_TEST_CASE(MultipleFromMappings)
   }
 }
 
+/// Both read mappings only share their input data, hence they are performed concurrently
+BOOST_AUTO_TEST_CASE(ConcurrentMappings)
+{
+  PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank));
+
+  using Eigen::Vector2d;
+  using namespace precice::constants;
+
+  const std::string configFile = _pathToTests + "concurrent-mappings.xml";
+
+  SolverInterface     interface(context.name, configFile, 0, 1);
+  std::vector<double> positions{0.0, 0.0, 1.0, 0.0, 2.0, 0.0};
+  std::vector<int>    vertexIDs(3);
+
+  if (context.isNamed("A")) {
+    const int        meshIDTop    = interface.getMeshID("MeshATop");
+    const int        meshIDBottom = interface.getMeshID("MeshABottom");
+    std::vector<int> vertexIDsBottom(3);
+    interface.setMeshVertices(meshIDTop, 3, positions.data(), vertexIDs.data());
+    interface.setMeshVertices(meshIDBottom, 3, positions.data(), vertexIDsBottom.data());
+    int dataIDTop    = interface.getDataID("Pressure", meshIDTop);
+    int dataIDBottom = interface.getDataID("Pressure", meshIDBottom);
+
+    double dt = interface.initialize();
+    interface.advance(dt);
+    std::vector<double> pressure(3, -1.0);
+    interface.readBlockScalarData(dataIDTop, 3, vertexIDs.data(), pressure.data());
+    BOOST_TEST(pressure == std::vector<double>({1.0, 2.0, 3.0}), boost::test_tools::per_element());
+    pressure.assign(3, -1.0);
+    interface.readBlockScalarData(dataIDBottom, 3, vertexIDsBottom.data(), pressure.data());
+    BOOST_TEST(pressure == std::vector<double>({1.0, 2.0, 3.0}), boost::test_tools::per_element());
+    BOOST_TEST(testing::WhiteboxAccessor::impl(interface).concurrentMappings() == 2);
+    BOOST_TEST(not interface.isCouplingOngoing());
+    interface.finalize();
+
+  } else {
+    BOOST_TEST(context.isNamed("B"));
+    const int meshID = interface.getMeshID("MeshB");
+    interface.setMeshVertices(meshID, 3, positions.data(), vertexIDs.data());
+    int dataID = interface.getDataID("Pressure", meshID);
+
+    double              dt = interface.initialize();
+    std::vector<double> pressure{1.0, 2.0, 3.0};
+    interface.writeBlockScalarData(dataID, 3, vertexIDs.data(), pressure.data());
+    interface.advance(dt);
+    BOOST_TEST(not interface.isCouplingOngoing());
+    interface.finalize();
+  }
+}
+
 BOOST_AUTO_TEST_CASE(MultipleToMappings)
 {
   PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank));
@@ -3,6 +3,7 @@
 #include "impl/Indexer.hpp"
 #include "logging/LogMacros.hpp"
 #include "utils/Event.hpp"
+#include "utils/Threads.hpp"
 
 namespace precice {
 extern bool syncMode;
@@ -13,8 +14,43 @@ precice::logging::Logger Index::_log{"query::Index"};
 namespace bg  = boost::geometry;
 namespace bgi = boost::geometry::index;
 
+namespace {
+/// Minimal number of queries per thread for batched queries, smaller batches are not worth the thread overhead
+constexpr size_t minQueriesPerThread = 256;
+} // namespace
+
 struct Index::IndexImpl {
   impl::MeshIndices indices;
+
+  /// Returns the vertex tree of the mesh, which is created on the first call
+  const impl::VertexTraits::RTree &vertexTree(const mesh::PtrMesh &mesh)
+  {
+    if (not indices.vertexRTree) {
+      precice::utils::Event event("query.index.getVertexIndexTree." + mesh->getName(), precice::syncMode);
+      indices.vertexRTree = impl::Indexer::instance()->getVertexRTree(mesh);
+    }
+    return *indices.vertexRTree;
+  }
+
+  /// Returns the edge tree of the mesh, which is created on the first call
+  const impl::EdgeTraits::RTree &edgeTree(const mesh::PtrMesh &mesh)
+  {
+    if (not indices.edgeRTree) {
+      precice::utils::Event event("query.index.getEdgeIndexTree." + mesh->getName(), precice::syncMode);
+      indices.edgeRTree = impl::Indexer::instance()->getEdgeRTree(mesh);
+    }
+    return *indices.edgeRTree;
+  }
+
+  /// Returns the triangle tree of the mesh, which is created on the first call
+  const impl::TriangleTraits::RTree &triangleTree(const mesh::PtrMesh &mesh)
+  {
+    if (not indices.triangleRTree) {
+      precice::utils::Event event("query.index.getTriangleIndexTree." + mesh->getName(), precice::syncMode);
+      indices.triangleRTree = impl::Indexer::instance()->getTriangleRTree(mesh);
+    }
+    return *indices.triangleRTree;
+  }
 };
 
 Index::Index(const mesh::PtrMesh &mesh)
@@ -30,106 +66,134 @@ Index::~Index()
 VertexMatch Index::getClosestVertex(const mesh::Vertex &sourceVertex)
 {
   PRECICE_TRACE();
-  // Add tree to the local cache
-  if (not _pimpl->indices.vertexRTree) {
-    precice::utils::Event event("query.index.getVertexIndexTree." + _mesh->getName(), precice::syncMode);
-    _pimpl->indices.vertexRTree = impl::Indexer::instance()->getVertexRTree(_mesh);
-    event.stop();
-  }
+  const auto &tree = _pimpl->vertexTree(_mesh);
 
   std::vector<VertexMatch> matches;
-  _pimpl->indices.vertexRTree->query(bgi::nearest(sourceVertex, 1), boost::make_function_output_iterator([&](size_t matchID) {
-                                       matches.emplace_back(bg::distance(sourceVertex, _mesh->vertices()[matchID]), matchID);
-                                     }));
+  tree.query(bgi::nearest(sourceVertex, 1), boost::make_function_output_iterator([&](impl::VertexTraits::IndexType const &match) {
+               matches.emplace_back(bg::distance(sourceVertex, _mesh->vertices()[match.second]), match.second);
+             }));
   return matches.back();
 }
 
 std::vector<VertexMatch> Index::getClosestVertices(const mesh::Vertex &sourceVertex, int n)
 {
   PRECICE_TRACE();
-  // Add tree to the local cache
-  if (not _pimpl->indices.vertexRTree) {
-    precice::utils::Event event("query.index.getVertexIndexTree." + _mesh->getName(), precice::syncMode);
-    _pimpl->indices.vertexRTree = impl::Indexer::instance()->getVertexRTree(_mesh);
-    event.stop();
-  }
+  const auto &tree = _pimpl->vertexTree(_mesh);
 
   std::vector<VertexMatch> matches;
-  _pimpl->indices.vertexRTree->query(bgi::nearest(sourceVertex, n), boost::make_function_output_iterator([&](size_t matchID) {
-                                       matches.emplace_back(bg::distance(sourceVertex, _mesh->vertices()[matchID]), matchID);
-                                     }));
+  tree.query(bgi::nearest(sourceVertex, n), boost::make_function_output_iterator([&](impl::VertexTraits::IndexType const &match) {
+               matches.emplace_back(bg::distance(sourceVertex, _mesh->vertices()[match.second]), match.second);
+             }));
   std::sort(matches.begin(), matches.end());
   return matches;
 }
 
+std::vector<VertexMatch> Index::getClosestVertices(const Eigen::Ref<const Eigen::MatrixXd> &positions)
+{
+  PRECICE_TRACE(positions.cols());
+  PRECICE_ASSERT(positions.rows() == _mesh->getDimensions(), positions.rows(), _mesh->getDimensions());
+  const auto &tree = _pimpl->vertexTree(_mesh);
+  PRECICE_ASSERT(not tree.empty() || positions.cols() == 0, _mesh->getName());
+
+  // Concurrent queries are safe, as they do not modify the tree
+  std::vector<VertexMatch> matches(positions.cols());
+  utils::parallelFor(matches.size(), minQueriesPerThread, [&](size_t begin, size_t end) {
+    mesh::Vertex::RawCoords position;
+    for (size_t i = begin; i < end; ++i) {
+      position = positions.col(i);
+      tree.query(bgi::nearest(position, 1), boost::make_function_output_iterator([&](impl::VertexTraits::IndexType const &match) {
+                   matches[i] = VertexMatch(bg::distance(position, match.first), match.second);
+                 }));
+    }
+  });
+  return matches;
+}
+
 std::vector<EdgeMatch> Index::getClosestEdges(const mesh::Vertex &sourceVertex, int n)
 {
   PRECICE_TRACE();
-  // Add tree to the local cache
-  if (not _pimpl->indices.edgeRTree) {
-    precice::utils::Event event("query.index.getEdgeIndexTree." + _mesh->getName(), precice::syncMode);
-    _pimpl->indices.edgeRTree = impl::Indexer::instance()->getEdgeRTree(_mesh);
-    event.stop();
-  }
+  const auto &tree = _pimpl->edgeTree(_mesh);
 
   std::vector<EdgeMatch> matches;
-  _pimpl->indices.edgeRTree->query(bgi::nearest(sourceVertex, n), boost::make_function_output_iterator([&](size_t matchID) {
-                                     matches.emplace_back(bg::distance(sourceVertex, _mesh->edges()[matchID]), matchID);
-                                   }));
+  tree.query(bgi::nearest(sourceVertex, n), boost::make_function_output_iterator([&](impl::EdgeTraits::IndexType const &match) {
+               matches.emplace_back(bg::distance(sourceVertex, _mesh->edges()[match.second]), match.second);
+             }));
   std::sort(matches.begin(), matches.end());
   return matches;
 }
 
+void Index::visitClosestEdges(const mesh::Vertex &sourceVertex, int n, const EdgeVisitor &visitor)
+{
+  const auto &tree = _pimpl->edgeTree(_mesh);
+
+  for (auto it = tree.qbegin(bgi::nearest(sourceVertex, n)); it != tree.qend(); ++it) {
+    if (not visitor(EdgeMatch(bg::distance(sourceVertex, it->first), it->second))) {
+      return;
+    }
+  }
+}
+
 std::vector<TriangleMatch> Index::getClosestTriangles(const mesh::Vertex &sourceVertex, int n)
 {
   PRECICE_TRACE();
-  // Add tree to the local cache
-  if (not _pimpl->indices.triangleRTree) {
-    precice::utils::Event event("query.index.getTriangleIndexTree." + _mesh->getName(), precice::syncMode);
-    _pimpl->indices.triangleRTree = impl::Indexer::instance()->getTriangleRTree(_mesh);
-    event.stop();
-  }
+  const auto &tree = _pimpl->triangleTree(_mesh);
 
   std::vector<TriangleMatch> matches;
-  _pimpl->indices.triangleRTree->query(bgi::nearest(sourceVertex, n),
-                                       boost::make_function_output_iterator([&](impl::TriangleTraits::IndexType const &match) {
-                                         matches.emplace_back(bg::distance(sourceVertex, _mesh->triangles()[match.second]), match.second);
-                                       }));
+  tree.query(bgi::nearest(sourceVertex, n), boost::make_function_output_iterator([&](impl::TriangleTraits::IndexType const &match) {
+               matches.emplace_back(bg::distance(sourceVertex, _mesh->triangles()[match.second]), match.second);
+             }));
   std::sort(matches.begin(), matches.end());
   return matches;
 }
 
-std::vector<size_t> Index::getVerticesInsideBox(const mesh::Vertex &centerVertex, double radius)
+void Index::visitClosestTriangles(const mesh::Vertex &sourceVertex, int n, const TriangleVisitor &visitor)
+{
+  const auto &tree = _pimpl->triangleTree(_mesh);
+
+  for (auto it = tree.qbegin(bgi::nearest(sourceVertex, n)); it != tree.qend(); ++it) {
+    if (not visitor(TriangleMatch(bg::distance(sourceVertex, it->first), it->second))) {
+      return;
+    }
+  }
+}
+
+void Index::createIndexTrees()
 {
   PRECICE_TRACE();
-  // Add tree to the local cache
-  if (_pimpl->indices.vertexRTree == nullptr) {
-    precice::utils::Event event("query.index.getVertexIndexTree." + _mesh->getName(), precice::syncMode);
-    _pimpl->indices.vertexRTree = impl::Indexer::instance()->getVertexRTree(_mesh);
-    event.stop();
+  _pimpl->vertexTree(_mesh);
+  _pimpl->edgeTree(_mesh);
+  if (_mesh->getDimensions() == 3) {
+    _pimpl->triangleTree(_mesh);
   }
+}
+
+std::vector<size_t> Index::getVerticesInsideBox(const mesh::Vertex &centerVertex, double radius)
+{
+  PRECICE_TRACE();
+  const auto &tree = _pimpl->vertexTree(_mesh);
 
   // Prepare boost::geometry box
   auto &          coords = centerVertex.getCoords();
   query::RTreeBox searchBox{coords.array() - radius, coords.array() + radius};
 
   std::vector<size_t> matches;
-  _pimpl->indices.vertexRTree->query(bgi::intersects(searchBox) and bg::index::satisfies([&](size_t const i) { return bg::distance(centerVertex, _mesh->vertices()[i]) <= radius; }),
-                                     std::back_inserter(matches));
+  tree.query(bgi::intersects(searchBox) and bg::index::satisfies([&](impl::VertexTraits::IndexType const &match) { return bg::distance(centerVertex, match.first) <= radius; }),
+             boost::make_function_output_iterator([&](impl::VertexTraits::IndexType const &match) {
+               matches.push_back(match.second);
+             }));
   return matches;
 }
 
 std::vector<size_t> Index::getVerticesInsideBox(const mesh::BoundingBox &bb)
 {
   PRECICE_TRACE();
-  // Add tree to the local cache
-  if (not _pimpl->indices.vertexRTree) {
-    precice::utils::Event event("query.index.getVertexIndexTree." + _mesh->getName(), precice::syncMode);
-    _pimpl->indices.vertexRTree = impl::Indexer::instance()->getVertexRTree(_mesh);
-    event.stop();
-  }
+  const auto &tree = _pimpl->vertexTree(_mesh);
+
   std::vector<size_t> matches;
-  _pimpl->indices.vertexRTree->query(bgi::intersects(query::RTreeBox{bb.minCorner(), bb.maxCorner()}), std::back_inserter(matches));
+  tree.query(bgi::intersects(query::RTreeBox{bb.minCorner(), bb.maxCorner()}),
+             boost::make_function_output_iterator([&](impl::VertexTraits::IndexType const &match) {
+               matches.push_back(match.second);
+             }));
   return matches;
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <Eigen/Core>
+#include <functional>
 #include <memory>
 #include <vector>
 #include "logging/Logger.hpp"
@@ -45,12 +47,47 @@ public:
   /// Get n number of closest vertices to the given vertex
   std::vector<VertexMatch> getClosestVertices(const mesh::Vertex &sourceVertex, int n);
 
+  /**
+   * @brief Get the closest vertex to each of the given positions
+   *
+   * The queries are distributed over the threads configured by utils::setThreadCount().
+   *
+   * @param[in] positions the positions to query, one position per column
+   * @return the closest vertex and its distance for every position
+   */
+  std::vector<VertexMatch> getClosestVertices(const Eigen::Ref<const Eigen::MatrixXd> &positions);
+
   /// Get n number of closest edges to the given vertex
   std::vector<EdgeMatch> getClosestEdges(const mesh::Vertex &sourcesVertex, int n);
 
+  /// Called with the next closest edge, returns false to stop the query
+  using EdgeVisitor = std::function<bool(const EdgeMatch &match)>;
+
+  /// Visits the n closest edges to the given vertex incrementally, sorted by distance
+  void visitClosestEdges(const mesh::Vertex &sourceVertex, int n, const EdgeVisitor &visitor);
+
   /// Get n number of closest triangles to the given vertex
   std::vector<TriangleMatch> getClosestTriangles(const mesh::Vertex &sourceVertex, int n);
 
+  /// Called with the next closest triangle, returns false to stop the query
+  using TriangleVisitor = std::function<bool(const TriangleMatch &match)>;
+
+  /**
+   * @brief Visits the n closest triangles to the given vertex incrementally.
+   *
+   * The triangles are indexed by their bounding boxes, hence the distance of a match is the distance
+   * to the bounding box of the triangle. It is a lower bound of the distance to this and all following triangles.
+   */
+  void visitClosestTriangles(const mesh::Vertex &sourceVertex, int n, const TriangleVisitor &visitor);
+
+  /**
+   * @brief Creates the index trees of the vertices, edges and, in 3D, triangles of the mesh.
+   *
+   * The trees are otherwise created on the first query. Afterwards, queries do not
+   * modify the index and may thus be issued concurrently.
+   */
+  void createIndexTrees();
+
   /// Return all the vertices inside the box formed by vertex and radius
   std::vector<size_t> getVerticesInsideBox(const mesh::Vertex &centerVertex, double radius);
 
@@ -1,11 +1,128 @@
 #include "Indexer.hpp"
-#include <boost/range/irange.hpp>
+#include <algorithm>
 #include "mesh/BoundingBox.hpp"
 
 namespace precice {
 namespace query {
 namespace impl {
 
+namespace {
+
+/// Fraction of changed primitives above which an outdated tree is repacked instead of updated
+constexpr double repackThreshold = 0.1;
+
+VertexTraits::Indexable makeIndexable(const mesh::Vertex &vertex)
+{
+  return vertex.getCoords();
+}
+
+EdgeTraits::Indexable makeIndexable(const mesh::Edge &edge)
+{
+  return {edge.vertex(0).getCoords(), edge.vertex(1).getCoords()};
+}
+
+TriangleTraits::Indexable makeIndexable(const mesh::Triangle &triangle)
+{
+  return bg::return_envelope<RTreeBox>(triangle);
+}
+
+bool isSame(const mesh::Vertex::RawCoords &lhs, const mesh::Vertex::RawCoords &rhs)
+{
+  return lhs.size() == rhs.size() && lhs == rhs;
+}
+
+bool isSame(const EdgeTraits::Indexable &lhs, const EdgeTraits::Indexable &rhs)
+{
+  return isSame(lhs.first, rhs.first) && isSame(lhs.second, rhs.second);
+}
+
+bool isSame(const RTreeBox &lhs, const RTreeBox &rhs)
+{
+  return isSame(lhs.min_corner(), rhs.min_corner()) && isSame(lhs.max_corner(), rhs.max_corner());
+}
+
+/// Packs all primitives of the container into the given tree, replacing its content
+template <typename Traits>
+void packTree(typename Traits::RTree &tree, const typename Traits::MeshContainer &container)
+{
+  // We first generate the values for the rtree.
+  // The resulting vector is a random access range, which can be passed to the
+  // constructor of the rtree for more efficient indexing.
+  std::vector<typename Traits::IndexType> elements;
+  elements.reserve(container.size());
+  for (size_t i = 0; i < container.size(); ++i) {
+    elements.emplace_back(makeIndexable(container[i]), i);
+  }
+
+  // Generating the rtree is expensive, so passing everything in the ctor is
+  // the best we can do. Even passing a range instead of calling
+  // tree.insert repeatedly is about 10x faster.
+  tree = typename Traits::RTree(elements, RTreeParameters{}, typename Traits::IndexGetter{});
+}
+
+/// Creates a packed tree of all primitives of the container
+template <typename Traits>
+typename Traits::Ptr buildTree(const typename Traits::MeshContainer &container)
+{
+  auto tree = std::make_shared<typename Traits::RTree>();
+  packTree<Traits>(*tree, container);
+  return tree;
+}
+
+/** Updates the tree to match the primitives of the container
+ *
+ * Values of the tree which no longer match their primitive are removed and the
+ * changed or added primitives are inserted.
+ * If too many primitives changed, the tree is repacked as this is considerably
+ * faster than inserting many values individually.
+ */
+template <typename Traits>
+void updateTree(typename Traits::RTree &tree, const typename Traits::MeshContainer &container)
+{
+  const auto                              size = container.size();
+  std::vector<typename Traits::IndexType> outdated;
+  std::vector<bool>                       indexed(size, false);
+  for (const auto &value : tree) {
+    const auto index = value.second;
+    if (index < size && !indexed[index] && isSame(value.first, makeIndexable(container[index]))) {
+      indexed[index] = true;
+    } else {
+      outdated.push_back(value);
+    }
+  }
+  const auto missing = static_cast<size_t>(std::count(indexed.begin(), indexed.end(), false));
+
+  if (outdated.size() + missing > repackThreshold * size) {
+    packTree<Traits>(tree, container);
+    return;
+  }
+
+  for (const auto &value : outdated) {
+    tree.remove(value);
+  }
+  for (size_t i = 0; i < size; ++i) {
+    if (!indexed[i]) {
+      tree.insert(typename Traits::IndexType{makeIndexable(container[i]), i});
+    }
+  }
+}
+
+/// Returns the cached tree of the container, creating or updating it if required
+template <typename Traits>
+typename Traits::Ptr getTree(typename Traits::Ptr &tree, const typename Traits::MeshContainer &container)
+{
+  if (!tree) {
+    tree = buildTree<Traits>(container);
+  } else {
+    // Primitives may be moved or added without emitting Mesh::meshChanged,
+    // e.g. by mappings or through the solver interface
+    updateTree<Traits>(*tree, container);
+  }
+  return tree;
+}
+
+} // namespace
+
 std::shared_ptr<Indexer> Indexer::instance()
 {
   static std::shared_ptr<Indexer> indexer{new Indexer};
@@ -22,67 +139,21 @@ VertexTraits::Ptr Indexer::getVertexRTree(const mesh::PtrMesh &mesh)
 {
   PRECICE_ASSERT(mesh);
   auto &cache = cacheEntry(mesh->getID());
-  if (cache.vertexRTree) {
-    return cache.vertexRTree;
-  }
-
-  // Generating the rtree is expensive, so passing everything in the ctor is
-  // the best we can do. Even passing an index range instead of calling
-  // tree->insert repeatedly is about 10x faster.
-  impl::RTreeParameters     params;
-  VertexTraits::IndexGetter ind(mesh->vertices());
-  auto                      tree = std::make_shared<VertexTraits::RTree>(
-      boost::irange<std::size_t>(0lu, mesh->vertices().size()), params, ind);
-
-  cache.vertexRTree = std::move(tree);
-  return cache.vertexRTree;
+  return getTree<VertexTraits>(cache.vertexRTree, mesh->vertices());
 }
 
 EdgeTraits::Ptr Indexer::getEdgeRTree(const mesh::PtrMesh &mesh)
 {
   PRECICE_ASSERT(mesh);
   auto &cache = cacheEntry(mesh->getID());
-  if (cache.edgeRTree) {
-    return cache.edgeRTree;
-  }
-
-  // Generating the rtree is expensive, so passing everything in the ctor is
-  // the best we can do. Even passing an index range instead of calling
-  // tree->insert repeatedly is about 10x faster.
-  impl::RTreeParameters   params;
-  EdgeTraits::IndexGetter ind(mesh->edges());
-  auto                    tree = std::make_shared<EdgeTraits::RTree>(
-      boost::irange<std::size_t>(0lu, mesh->edges().size()), params, ind);
-
-  cache.edgeRTree = std::move(tree);
-  return cache.edgeRTree;
+  return getTree<EdgeTraits>(cache.edgeRTree, mesh->edges());
 }
 
 TriangleTraits::Ptr Indexer::getTriangleRTree(const mesh::PtrMesh &mesh)
 {
   PRECICE_ASSERT(mesh);
   auto &cache = cacheEntry(mesh->getID());
-  if (cache.triangleRTree) {
-    return cache.triangleRTree;
-  }
-
-  // We first generate the values for the triangle rtree.
-  // The resulting vector is a random access range, which can be passed to the
-  // constructor of the rtree for more efficient indexing.
-  std::vector<TriangleTraits::IndexType> elements;
-  elements.reserve(mesh->triangles().size());
-  for (size_t i = 0; i < mesh->triangles().size(); ++i) {
-    auto box = bg::return_envelope<RTreeBox>(mesh->triangles()[i]);
-    elements.emplace_back(std::move(box), i);
-  }
-
-  // Generating the rtree is expensive, so passing everything in the ctor is
-  // the best we can do.
-  impl::RTreeParameters       params;
-  TriangleTraits::IndexGetter ind;
-  auto                        tree = std::make_shared<TriangleTraits::RTree>(elements, params, ind);
-  cache.triangleRTree              = std::move(tree);
-  return cache.triangleRTree;
+  return getTree<TriangleTraits>(cache.triangleRTree, mesh->triangles());
 }
 
 size_t Indexer::getCacheSize()
@@ -102,4 +173,4 @@ void Indexer::clearCache(int meshID)
 
 } // namespace impl
 } // namespace query
-} // namespace precice
\ No newline at end of file
+} // namespace precice
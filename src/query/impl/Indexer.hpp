@@ -25,13 +25,18 @@ public:
 
   static std::shared_ptr<Indexer> instance();
 
-  /// Return vertex index tree from cache, if cache is empty, create the tree
+  /**
+   * @brief Return vertex index tree from cache, if cache is empty, create the tree
+   *
+   * A cached tree is compared to the mesh first. Changed or added vertices are
+   * updated in the existing tree, unless repacking the tree is cheaper.
+   */
   VertexTraits::Ptr getVertexRTree(const mesh::PtrMesh &mesh);
 
-  /// Return edge index tree from cache, if cache is empty, create the tree
+  /// Return edge index tree from cache, if cache is empty, create the tree. Updates a cached tree like getVertexRTree().
   EdgeTraits::Ptr getEdgeRTree(const mesh::PtrMesh &mesh);
 
-  /// Return triangle index tree from cache, if cache is empty, create the tree
+  /// Return triangle index tree from cache, if cache is empty, create the tree. Updates a cached tree like getVertexRTree().
   TriangleTraits::Ptr getTriangleRTree(const mesh::PtrMesh &mesh);
 
   size_t getCacheSize();
@@ -44,10 +49,11 @@ public:
 
 private:
   Indexer(){};
+
   MeshIndices &              cacheEntry(int meshID);
   std::map<int, MeshIndices> _cachedTrees;
 };
 
 } // namespace impl
 } // namespace query
-} // namespace precice
\ No newline at end of file
+} // namespace precice
@@ -19,29 +19,31 @@ namespace boost {
 namespace geometry {
 namespace traits {
 
-/// Adapts Eigen::VectorXd to boost.geometry
+/// Adapts dynamically sized Eigen vectors to boost.geometry
 /*
- * This adapts every VectorXd to a 3d point. For non-existing dimensions, zero is returned.
+ * This adapts every VectorXd and Vertex::RawCoords to a 3d point. For non-existing dimensions, zero is returned.
  */
-template <>
-struct tag<Eigen::VectorXd> {
+template <int MaxRows>
+struct tag<Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, MaxRows, 1>> {
   using type = point_tag;
 };
-template <>
-struct coordinate_type<Eigen::VectorXd> {
+template <int MaxRows>
+struct coordinate_type<Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, MaxRows, 1>> {
   using type = double;
 };
-template <>
-struct coordinate_system<Eigen::VectorXd> {
+template <int MaxRows>
+struct coordinate_system<Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, MaxRows, 1>> {
   using type = cs::cartesian;
 };
-template <>
-struct dimension<Eigen::VectorXd> : boost::mpl::int_<3> {
+template <int MaxRows>
+struct dimension<Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, MaxRows, 1>> : boost::mpl::int_<3> {
 };
 
-template <size_t Dimension>
-struct access<Eigen::VectorXd, Dimension> {
-  static double get(Eigen::VectorXd const &p)
+template <int MaxRows, size_t Dimension>
+struct access<Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, MaxRows, 1>, Dimension> {
+  using Vector = Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, MaxRows, 1>;
+
+  static double get(Vector const &p)
   {
     if (Dimension >= static_cast<size_t>(p.rows()))
       return 0;
@@ -49,17 +51,18 @@ struct access<Eigen::VectorXd, Dimension> {
     return p[Dimension];
   }
 
-  static void set(Eigen::VectorXd &p, double const &value)
+  static void set(Vector &p, double const &value)
   {
-    // This handles default initialized VectorXd
+    // This handles default initialized vectors
     if (p.size() == 0) {
-      p = Eigen::VectorXd::Zero(3);
+      p = Vector::Zero(3);
     }
     p[Dimension] = value;
   }
 };
 
 BOOST_CONCEPT_ASSERT((bg::concepts::Point<Eigen::VectorXd>) );
+BOOST_CONCEPT_ASSERT((bg::concepts::Point<pm::Vertex::RawCoords>) );
 
 /// Provides the necessary template specialisations to adapt precice's Vertex to boost.geometry
 /*
@@ -93,7 +96,7 @@ struct access<pm::Vertex, Dimension> {
 
   static void set(pm::Vertex &p, double const &value)
   {
-    Eigen::VectorXd vec = p.getCoords();
+    pm::Vertex::RawCoords vec = p.getCoords();
     vec[Dimension]      = value;
     p.setCoords(vec);
   }
@@ -112,7 +115,7 @@ struct tag<pm::Edge> {
 };
 template <>
 struct point_type<pm::Edge> {
-  using type = Eigen::VectorXd;
+  using type = pm::Vertex::RawCoords;
 };
 
 template <size_t Index, size_t Dimension>
@@ -122,13 +125,13 @@ struct indexed_access<pm::Edge, Index, Dimension> {
 
   static double get(pm::Edge const &e)
   {
-    return access<Eigen::VectorXd, Dimension>::get(e.vertex(Index).getCoords());
+    return access<pm::Vertex::RawCoords, Dimension>::get(e.vertex(Index).getCoords());
   }
 
   static void set(pm::Edge &e, double const &value)
   {
-    Eigen::VectorXd v = e.vertex(Index).getCoords();
-    access<Eigen::VectorXd, Dimension>::set(v, value);
+    pm::Vertex::RawCoords v = e.vertex(Index).getCoords();
+    access<pm::Vertex::RawCoords, Dimension>::set(v, value);
     e.vertex(Index).setCoords(std::move(v));
   }
 };
@@ -161,7 +164,7 @@ namespace precice {
 namespace query {
 
 /// The RTree box type
-using RTreeBox = boost::geometry::model::box<Eigen::VectorXd>;
+using RTreeBox = boost::geometry::model::box<pm::Vertex::RawCoords>;
 
 namespace impl {
 
@@ -176,16 +179,19 @@ struct PrimitiveTraits;
 template <>
 struct PrimitiveTraits<mesh::Vertex> {
   using MeshContainer = mesh::Mesh::VertexContainer;
+  using Indexable     = mesh::Vertex::RawCoords;
 };
 
 template <>
 struct PrimitiveTraits<mesh::Edge> {
   using MeshContainer = mesh::Mesh::EdgeContainer;
+  using Indexable     = boost::geometry::model::segment<mesh::Vertex::RawCoords>;
 };
 
 template <>
 struct PrimitiveTraits<mesh::Triangle> {
   using MeshContainer = mesh::Mesh::TriangleContainer;
+  using Indexable     = RTreeBox;
 };
 
 /// Makes a utils::PtrVector indexable and thus be usable in boost::geometry::rtree
@@ -209,75 +215,20 @@ public:
   }
 };
 
-/// Makes a std::vector indexable and thus be usable in boost::geometry::rtree
-template <typename Container>
-class VectorIndexable {
-  using size_type = typename Container::size_type;
-  using cref      = const typename Container::value_type &;
-  Container const &container;
-
-public:
-  using result_type = cref;
-
-  explicit VectorIndexable(Container const &c)
-      : container(c)
-  {
-  }
-
-  result_type operator()(size_type i) const
-  {
-    return container[i];
-  }
-};
-
-template <typename Primitive>
-class IsDirectIndexableHelper {
-private:
-  template <typename T, typename = typename std::enable_if<
-                            std::is_same<
-                                typename boost::geometry::traits::tag<T>::type,
-                                boost::geometry::point_tag>::value,
-                            std::nullptr_t>::type>
-  static std::true_type test(char *);
-  template <typename T, typename = typename std::enable_if<
-                            std::is_same<
-                                typename boost::geometry::traits::tag<T>::type,
-                                boost::geometry::segment_tag>::value,
-                            std::nullptr_t>::type>
-  static std::true_type test(int *);
-  template <typename T, typename = typename std::enable_if<
-                            std::is_same<
-                                typename boost::geometry::traits::tag<T>::type,
-                                boost::geometry::box_tag>::value,
-                            std::nullptr_t>::type>
-  static std::true_type test(void *);
-
-  template <typename T>
-  static std::false_type test(...);
-
-public:
-  using type = decltype(test<Primitive>(nullptr));
-};
-
-template <class Primitive>
-struct IsDirectIndexable : impl::IsDirectIndexableHelper<Primitive>::type {
-};
-
-/// The type traits of a rtree based on a Primitive
+/** The type traits of a rtree based on a Primitive
+ *
+ * The rtree stores a copy of the geometry it indexes, i.e. the coordinates of vertices,
+ * the segments of edges, and the envelopes of triangles.
+ * This allows to compare the tree to a changed mesh and to update it incrementally.
+ */
 template <class Primitive>
 struct RTreeTraits {
   using MeshContainer      = typename PrimitiveTraits<Primitive>::MeshContainer;
   using MeshContainerIndex = typename MeshContainer::size_type;
+  using Indexable          = typename PrimitiveTraits<Primitive>::Indexable;
 
-  using IndexType = typename std::conditional<
-      IsDirectIndexable<Primitive>::value,
-      MeshContainerIndex,
-      std::pair<RTreeBox, MeshContainerIndex>>::type;
-
-  using IndexGetter = typename std::conditional<
-      IsDirectIndexable<Primitive>::value,
-      impl::VectorIndexable<MeshContainer>,
-      boost::geometry::index::indexable<IndexType>>::type;
+  using IndexType   = std::pair<Indexable, MeshContainerIndex>;
+  using IndexGetter = boost::geometry::index::indexable<IndexType>;
 
   using RTree = boost::geometry::index::rtree<IndexType, RTreeParameters, IndexGetter>;
   using Ptr   = std::shared_ptr<RTree>;
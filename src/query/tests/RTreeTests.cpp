@@ -19,6 +19,7 @@
 #include "query/impl/Indexer.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
+#include "utils/Threads.hpp"
 
 using namespace precice;
 using namespace precice::mesh;
@@ -164,6 +165,32 @@ BOOST_AUTO_TEST_CASE(Query3DFullVertex)
   BOOST_TEST(mesh->vertices().at(result.index).getID() == v10.getID());
 }
 
+BOOST_AUTO_TEST_CASE(QueryBatchVertex)
+{
+  PRECICE_TEST(1_rank);
+  auto  mesh = vertexMesh3D();
+  Index indexTree(mesh);
+
+  // Enough positions to be split across threads
+  Eigen::MatrixXd positions(3, 1000);
+  for (int i = 0; i < positions.cols(); ++i) {
+    positions.col(i) = mesh->vertices()[i % 8].getCoords() + Eigen::Vector3d::Constant(0.1);
+  }
+
+  for (int threads : {1, 4}) {
+    utils::ScopedThreadCount threadCount(threads);
+    auto                     results = indexTree.getClosestVertices(positions);
+    BOOST_TEST(results.size() == 1000);
+    for (int i = 0; i < positions.cols(); ++i) {
+      mesh::Vertex searchVertex(positions.col(i), -1);
+      auto         expected = indexTree.getClosestVertex(searchVertex);
+      BOOST_TEST(results[i].index == i % 8);
+      BOOST_TEST(results[i].index == expected.index);
+      BOOST_TEST(results[i].distance == expected.distance);
+    }
+  }
+}
+
 /// Resembles how boost geometry is used inside the PetRBF
 BOOST_AUTO_TEST_CASE(QueryWithBoxEmpty)
 {
@@ -338,17 +365,49 @@ BOOST_AUTO_TEST_SUITE_END() // Triangle
 
 BOOST_AUTO_TEST_SUITE(Cache)
 
-BOOST_AUTO_TEST_CASE(ClearOnChange)
+BOOST_AUTO_TEST_CASE(UpdateOnChange)
 {
   PRECICE_TEST(1_rank);
   PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 2, false, precice::testing::nextMeshID()));
-  mesh->createVertex(Eigen::Vector2d(0, 0));
+  auto &  v0 = mesh->createVertex(Eigen::Vector2d(0, 0));
+  mesh->createVertex(Eigen::Vector2d(1, 0));
 
-  // The Cache should clear whenever a mesh changes
+  // The Cache should keep the tree whenever a mesh changes
   auto vTree = query::impl::Indexer::instance()->getVertexRTree(mesh);
   BOOST_TEST(query::impl::Indexer::instance()->getCacheSize() == 1);
+  BOOST_TEST(vTree->size() == 2);
+
+  v0.setCoords(Eigen::Vector2d(5, 5));
+  mesh->createVertex(Eigen::Vector2d(2, 0));
   mesh->meshChanged(*mesh); // Emit signal, that mesh has changed
-  BOOST_TEST(query::impl::Indexer::instance()->getCacheSize() == 0);
+  BOOST_TEST(query::impl::Indexer::instance()->getCacheSize() == 1);
+
+  // The tree is updated in place on its next use
+  auto updated = query::impl::Indexer::instance()->getVertexRTree(mesh);
+  BOOST_TEST(updated == vTree);
+  BOOST_TEST(updated->size() == 3);
+
+  query::Index index(mesh);
+  BOOST_TEST(index.getClosestVertex(precice::mesh::Vertex(Eigen::Vector2d(4, 4), -1)).index == 0);
+  BOOST_TEST(index.getClosestVertex(precice::mesh::Vertex(Eigen::Vector2d(2.1, 0), -1)).index == 2);
+}
+
+BOOST_AUTO_TEST_CASE(UpdateOnChangeEdges)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 2, false, precice::testing::nextMeshID()));
+  auto &  v0 = mesh->createVertex(Eigen::Vector2d(0, 0));
+  auto &  v1 = mesh->createVertex(Eigen::Vector2d(1, 0));
+  auto &  v2 = mesh->createVertex(Eigen::Vector2d(0, 1));
+  mesh->createEdge(v0, v1);
+  mesh->createEdge(v1, v2);
+
+  auto eTree = query::impl::Indexer::instance()->getEdgeRTree(mesh);
+  BOOST_TEST(eTree->size() == 2);
+
+  // Removing all edges repacks the tree
+  mesh->clear();
+  BOOST_TEST(query::impl::Indexer::instance()->getEdgeRTree(mesh)->size() == 0);
 }
 
 BOOST_AUTO_TEST_CASE(ClearOnDestruction)
@@ -63,10 +63,13 @@ target_sources(precice
     src/com/CommunicationFactory.hpp
     src/com/ConnectionInfoPublisher.cpp
     src/com/ConnectionInfoPublisher.hpp
+    src/com/IndexedLayout.hpp
     src/com/MPICommunication.cpp
     src/com/MPICommunication.hpp
     src/com/MPIDirectCommunication.cpp
     src/com/MPIDirectCommunication.hpp
+    src/com/MPIIndexedLayout.cpp
+    src/com/MPIIndexedLayout.hpp
     src/com/MPIPortsCommunication.cpp
     src/com/MPIPortsCommunication.hpp
     src/com/MPIPortsCommunicationFactory.cpp
@@ -79,6 +82,10 @@ target_sources(precice
     src/com/MPISinglePortsCommunicationFactory.hpp
     src/com/Request.cpp
     src/com/Request.hpp
+    src/com/SharedMemoryCommunication.cpp
+    src/com/SharedMemoryCommunication.hpp
+    src/com/SharedMemoryCommunicationFactory.cpp
+    src/com/SharedMemoryCommunicationFactory.hpp
     src/com/SharedPointer.hpp
     src/com/SocketCommunication.cpp
     src/com/SocketCommunication.hpp
@@ -165,13 +172,18 @@ target_sources(precice
     src/m2n/config/M2NConfiguration.hpp
     src/mapping/Mapping.cpp
     src/mapping/Mapping.hpp
+    src/mapping/MappingCache.cpp
+    src/mapping/MappingCache.hpp
     src/mapping/NearestNeighborMapping.cpp
     src/mapping/NearestNeighborMapping.hpp
     src/mapping/NearestProjectionMapping.cpp
     src/mapping/NearestProjectionMapping.hpp
+    src/mapping/PartitionOfUnityMapping.hpp
     src/mapping/PetRadialBasisFctMapping.hpp
     src/mapping/RadialBasisFctMapping.hpp
     src/mapping/SharedPointer.hpp
+    src/mapping/SparseOperator.cpp
+    src/mapping/SparseOperator.hpp
     src/mapping/config/MappingConfiguration.cpp
     src/mapping/config/MappingConfiguration.hpp
     src/mapping/impl/BasisFunctions.hpp
@@ -271,11 +283,15 @@ target_sources(precice
     src/utils/Petsc.cpp
     src/utils/Petsc.hpp
     src/utils/PointerVector.hpp
+    src/utils/SHA1.cpp
+    src/utils/SHA1.hpp
     src/utils/Statistics.hpp
     src/utils/String.cpp
     src/utils/String.hpp
     src/utils/TableWriter.cpp
     src/utils/TableWriter.hpp
+    src/utils/Threads.cpp
+    src/utils/Threads.hpp
     src/utils/TypeNames.hpp
     src/utils/algorithm.hpp
     src/utils/assertion.hpp
@@ -246,6 +246,7 @@ void EventRegistry::signal_handler(int signal)
 
 void EventRegistry::put(Event const &event)
 {
+  std::lock_guard<std::mutex> lock(putMutex);
   localRankData.put(event);
 }
 
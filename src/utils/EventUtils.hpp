@@ -3,6 +3,7 @@
 #include <chrono>
 #include <iosfwd>
 #include <map>
+#include <mutex>
 #include <stddef.h>
 #include <string>
 #include <utility>
@@ -135,7 +136,7 @@ public:
   /// Finalizes the timings and calls print. Can be used as a crash handler to still get some timing results.
   void signal_handler(int signal);
 
-  /// Records the event.
+  /// Records the event, may be called concurrently.
   void put(Event const &event);
 
   /// Returns or creates a stored event, i.e., an event with life beyond the current scope
@@ -167,6 +168,9 @@ private:
 
   RankData localRankData;
 
+  /// Guards localRankData against concurrent calls to put()
+  std::mutex putMutex;
+
   /// Holds RankData from all ranks, only populated at rank 0
   std::vector<RankData> globalRankData;
 
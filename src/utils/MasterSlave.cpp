@@ -207,6 +207,28 @@ void MasterSlave::allreduceSum(double *sendData, double *rcvData, int size)
   }
 }
 
+void MasterSlave::allreduceSum(int *sendData, int *rcvData, int size)
+{
+  PRECICE_TRACE();
+
+  if (not _isMaster && not _isSlave) {
+    return;
+  }
+
+  PRECICE_ASSERT(_communication.get() != nullptr);
+  PRECICE_ASSERT(_communication->isConnected());
+
+  if (_isSlave) {
+    // send local result to master, receive reduced result from master
+    _communication->allreduceSum(sendData, rcvData, size, 0);
+  }
+
+  if (_isMaster) {
+    // receive local results from slaves, apply SUM, send reduced result to slaves
+    _communication->allreduceSum(sendData, rcvData, size);
+  }
+}
+
 void MasterSlave::allreduceSum(double &sendData, double &rcvData, int size)
 {
   PRECICE_TRACE();
@@ -48,6 +48,8 @@ public:
 
   static void allreduceSum(double &sendData, double &rcvData, int size);
 
+  static void allreduceSum(int *sendData, int *rcvData, int size);
+
   static void allreduceSum(int &sendData, int &rcvData, int size);
 
   static void broadcast(bool &value);
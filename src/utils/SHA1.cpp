@@ -0,0 +1,99 @@
+#include "utils/SHA1.hpp"
+#include <iomanip>
+#include <sstream>
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace utils {
+
+namespace {
+std::uint32_t rotate(std::uint32_t value, int bits)
+{
+  return (value << bits) | (value >> (32 - bits));
+}
+} // namespace
+
+void SHA1::processBytes(const void *data, std::size_t size)
+{
+  PRECICE_ASSERT(not _finished, "The digest has already been finished.");
+  const auto *bytes = static_cast<const unsigned char *>(data);
+  for (std::size_t i = 0; i < size; ++i) {
+    _block[_blockSize++] = bytes[i];
+    if (_blockSize == _block.size()) {
+      processBlock();
+    }
+  }
+  _length += size;
+}
+
+SHA1::Digest SHA1::digest()
+{
+  PRECICE_ASSERT(not _finished, "The digest has already been finished.");
+  // Pad with a single one bit and zeros to 56 bytes modulo 64, followed by the message length in bits
+  const std::uint64_t bits = _length * 8;
+  const unsigned char one  = 0x80;
+  processBytes(&one, 1);
+  const unsigned char zero = 0;
+  while (_blockSize != 56) {
+    processBytes(&zero, 1);
+  }
+  for (int shift = 56; shift >= 0; shift -= 8) {
+    const auto byte = static_cast<unsigned char>(bits >> shift);
+    processBytes(&byte, 1);
+  }
+  _finished = true;
+  return _state;
+}
+
+std::string SHA1::hexDigest()
+{
+  std::ostringstream oss;
+  for (auto part : digest()) {
+    oss << std::hex << std::setw(8) << std::setfill('0') << part;
+  }
+  return oss.str();
+}
+
+void SHA1::processBlock()
+{
+  std::array<std::uint32_t, 80> w;
+  for (int i = 0; i < 16; ++i) {
+    w[i] = std::uint32_t{_block[4 * i]} << 24 | std::uint32_t{_block[4 * i + 1]} << 16 | std::uint32_t{_block[4 * i + 2]} << 8 | _block[4 * i + 3];
+  }
+  for (int i = 16; i < 80; ++i) {
+    w[i] = rotate(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+  }
+
+  std::uint32_t a = _state[0], b = _state[1], c = _state[2], d = _state[3], e = _state[4];
+  for (int i = 0; i < 80; ++i) {
+    std::uint32_t f, k;
+    if (i < 20) {
+      f = (b & c) | (~b & d);
+      k = 0x5A827999;
+    } else if (i < 40) {
+      f = b ^ c ^ d;
+      k = 0x6ED9EBA1;
+    } else if (i < 60) {
+      f = (b & c) | (b & d) | (c & d);
+      k = 0x8F1BBCDC;
+    } else {
+      f = b ^ c ^ d;
+      k = 0xCA62C1D6;
+    }
+    const std::uint32_t temp = rotate(a, 5) + f + e + k + w[i];
+    e                        = d;
+    d                        = c;
+    c                        = rotate(b, 30);
+    b                        = a;
+    a                        = temp;
+  }
+  _state[0] += a;
+  _state[1] += b;
+  _state[2] += c;
+  _state[3] += d;
+  _state[4] += e;
+  _blockSize = 0;
+}
+
+} // namespace utils
+} // namespace precice
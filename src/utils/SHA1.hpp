@@ -0,0 +1,40 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace precice {
+namespace utils {
+
+/**
+ * @brief Incremental SHA-1 digest as specified in FIPS 180-4.
+ *
+ * Bytes are fed in any number of chunks by processBytes(), the digest is finished by digest() or hexDigest().
+ */
+class SHA1 {
+public:
+  using Digest = std::array<std::uint32_t, 5>;
+
+  /// Appends size bytes of data to the message
+  void processBytes(const void *data, std::size_t size);
+
+  /// Finishes the digest, no more bytes may be processed afterwards
+  Digest digest();
+
+  /// Finishes the digest and returns it as 40 lowercase hexadecimal digits
+  std::string hexDigest();
+
+private:
+  void processBlock();
+
+  Digest                        _state{{0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0}};
+  std::array<unsigned char, 64> _block;
+  std::size_t                   _blockSize = 0;
+  std::uint64_t                 _length    = 0;
+  bool                          _finished  = false;
+};
+
+} // namespace utils
+} // namespace precice
@@ -1,12 +1,8 @@
 #pragma once
 
-#include <boost/accumulators/accumulators.hpp>
-#include <boost/accumulators/statistics/count.hpp>
-#include <boost/accumulators/statistics/max.hpp>
-#include <boost/accumulators/statistics/mean.hpp>
-#include <boost/accumulators/statistics/min.hpp>
-#include <boost/accumulators/statistics/stats.hpp>
-#include <boost/accumulators/statistics/variance.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <iosfwd>
 
 namespace precice {
@@ -15,43 +11,62 @@ namespace statistics {
 
 /**
  * Accunulates distance measures and provides statistics based on them.
+ *
+ * Accumulators of disjoint value sets, e.g. of different threads, can be combined using merge().
  */
 class DistanceAccumulator {
 public:
   /// Accumulates value
   void operator()(double value)
   {
-    _acc(value);
+    _min = empty() ? value : std::min(_min, value);
+    _max = empty() ? value : std::max(_max, value);
+    ++_count;
+    _sum += value;
+    _sumSquares += value * value;
+  }
+
+  /// Accumulates all values accumulated by other
+  void merge(const DistanceAccumulator &other)
+  {
+    if (other.empty()) {
+      return;
+    }
+    _min = empty() ? other._min : std::min(_min, other._min);
+    _max = empty() ? other._max : std::max(_max, other._max);
+    _count += other._count;
+    _sum += other._sum;
+    _sumSquares += other._sumSquares;
   }
 
   /// Returns the minimum of all accumulated values
   double min() const
   {
-    return empty() ? std::nan("") : boost::accumulators::extract::min(_acc);
+    return empty() ? std::nan("") : _min;
   }
 
   /// Returns the maximum of all accumulated values
   double max() const
   {
-    return empty() ? std::nan("") : boost::accumulators::extract::max(_acc);
+    return empty() ? std::nan("") : _max;
   }
 
   /// Returns the mean of all accumulated values
   double mean() const
   {
-    return empty() ? std::nan("") : boost::accumulators::extract::mean(_acc);
+    return empty() ? std::nan("") : _sum / _count;
   }
 
   /// Returns the sample variance based on all accumulated values
   double variance() const
   {
-    return empty() ? std::nan("") : boost::accumulators::extract::variance(_acc);
+    return empty() ? std::nan("") : _sumSquares / _count - mean() * mean();
   }
 
   /// Returns how many values have been accumulated
   std::size_t count() const
   {
-    return boost::accumulators::extract::count(_acc);
+    return _count;
   }
 
   /// Returns count == 0
@@ -61,12 +76,11 @@ public:
   }
 
 private:
-  boost::accumulators::accumulator_set<double, boost::accumulators::stats<
-                                                   boost::accumulators::tag::min,
-                                                   boost::accumulators::tag::max,
-                                                   boost::accumulators::tag::mean,
-                                                   boost::accumulators::tag::lazy_variance>>
-      _acc;
+  double      _min        = 0.0;
+  double      _max        = 0.0;
+  std::size_t _count      = 0;
+  double      _sum        = 0.0;
+  double      _sumSquares = 0.0;
 };
 
 inline std::ostream &operator<<(std::ostream &out, const DistanceAccumulator &accumulator)
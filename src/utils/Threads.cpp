@@ -0,0 +1,48 @@
+#include "utils/Threads.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace utils {
+
+namespace {
+int threadCount = 1;
+
+thread_local bool inParallelRegion = false;
+} // namespace
+
+bool isInParallelRegion()
+{
+  return inParallelRegion;
+}
+
+namespace impl {
+
+ParallelRegion::ParallelRegion()
+    : _previous(inParallelRegion)
+{
+  inParallelRegion = true;
+}
+
+ParallelRegion::~ParallelRegion()
+{
+  inParallelRegion = _previous;
+}
+
+} // namespace impl
+
+int getThreadCount()
+{
+  return threadCount;
+}
+
+void setThreadCount(int threads)
+{
+  PRECICE_ASSERT(threads >= 0, threads);
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  threadCount = threads;
+}
+
+} // namespace utils
+} // namespace precice
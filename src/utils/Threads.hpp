@@ -0,0 +1,123 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace precice {
+namespace utils {
+
+/// Returns the number of threads used by parallelFor()
+int getThreadCount();
+
+/// Sets the number of threads used by parallelFor(), 0 selects the number of hardware threads
+void setThreadCount(int threads);
+
+/// Returns true if the calling thread runs a chunk of parallelFor()
+bool isInParallelRegion();
+
+namespace impl {
+
+/// Marks the calling thread as running a chunk of parallelFor() for its lifetime
+class ParallelRegion {
+public:
+  ParallelRegion();
+
+  ~ParallelRegion();
+
+  ParallelRegion(const ParallelRegion &) = delete;
+  ParallelRegion &operator=(const ParallelRegion &) = delete;
+
+private:
+  bool _previous;
+};
+
+} // namespace impl
+
+/// Sets the number of threads used by parallelFor() for its lifetime and restores the previous one afterwards
+class ScopedThreadCount {
+public:
+  explicit ScopedThreadCount(int threads)
+      : _previous(getThreadCount())
+  {
+    setThreadCount(threads);
+  }
+
+  ~ScopedThreadCount()
+  {
+    setThreadCount(_previous);
+  }
+
+  ScopedThreadCount(const ScopedThreadCount &) = delete;
+  ScopedThreadCount &operator=(const ScopedThreadCount &) = delete;
+
+private:
+  int _previous;
+};
+
+/** Runs func(begin, end) on disjoint chunks of the range [0, size) using the configured number of threads.
+ *
+ * Every chunk spans at least minChunkSize elements, thus small ranges run on the calling thread only.
+ * The chunks are contiguous and do not depend on scheduling, the calling thread processes the first chunk.
+ * Hence, writing results per index requires no synchronization.
+ *
+ * Calls from within func run on the calling thread only, hence nested loops never use more than
+ * the configured number of threads.
+ *
+ * All threads are joined before returning. If func throws, the exception of the first chunk which threw
+ * is rethrown on the calling thread. As PRECICE_ERROR exits the process while other threads are running,
+ * func should report errors by throwing or by results which are checked after parallelFor() returned.
+ */
+template <typename Func>
+void parallelFor(std::size_t size, std::size_t minChunkSize, Func &&func)
+{
+  const std::size_t maxChunks = size / std::max<std::size_t>(minChunkSize, 1);
+  const std::size_t chunks    = std::min<std::size_t>(getThreadCount(), maxChunks);
+  if (chunks <= 1 || isInParallelRegion()) {
+    func(std::size_t{0}, size);
+    return;
+  }
+
+  auto chunkBegin = [size, chunks](std::size_t chunk) { return chunk * size / chunks; };
+
+  std::vector<std::exception_ptr> errors(chunks);
+  auto                            run = [&func, &errors, &chunkBegin](std::size_t chunk) {
+    impl::ParallelRegion region;
+    try {
+      func(chunkBegin(chunk), chunkBegin(chunk + 1));
+    } catch (...) {
+      errors[chunk] = std::current_exception();
+    }
+  };
+
+  {
+    std::vector<std::thread> workers;
+    // Joins the workers on every exit of this scope, also if starting a thread fails
+    struct Joiner {
+      std::vector<std::thread> &threads;
+      ~Joiner()
+      {
+        for (auto &thread : threads) {
+          thread.join();
+        }
+      }
+    } joiner{workers};
+
+    workers.reserve(chunks - 1);
+    for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+      workers.emplace_back(run, chunk);
+    }
+    run(0);
+  }
+
+  for (const auto &error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+} // namespace utils
+} // namespace precice
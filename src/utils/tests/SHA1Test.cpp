@@ -0,0 +1,63 @@
+#include <string>
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "utils/SHA1.hpp"
+
+using namespace precice;
+using namespace precice::utils;
+
+namespace {
+std::string hash(const std::string &message)
+{
+  SHA1 sha1;
+  sha1.processBytes(message.data(), message.size());
+  return sha1.hexDigest();
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_AUTO_TEST_SUITE(SHA1Tests)
+
+/// Test vectors of FIPS 180-4 and RFC 3174
+BOOST_AUTO_TEST_CASE(KnownAnswers)
+{
+  PRECICE_TEST(1_rank);
+  BOOST_TEST(hash("") == "da39a3ee5e6b4b0d3255bfef95601890afd80709");
+  BOOST_TEST(hash("abc") == "a9993e364706816aba3e25717850c26c9cd0d89d");
+  BOOST_TEST(hash("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") == "84983e441c3bd26ebaae4aa1f95129e5e54670f1");
+  BOOST_TEST(hash("The quick brown fox jumps over the lazy dog") == "2fd4e1c67a2d28fced849ee1bb76e7391b93eb12");
+}
+
+/// Messages around the block size exercise the padding into a second block
+BOOST_AUTO_TEST_CASE(BlockBoundaries)
+{
+  PRECICE_TEST(1_rank);
+  BOOST_TEST(hash(std::string(55, 'a')) == "c1c8bbdc22796e28c0e15163d20899b65621d65a");
+  BOOST_TEST(hash(std::string(56, 'a')) == "c2db330f6083854c99d4b5bfb6e8f29f201be699");
+  BOOST_TEST(hash(std::string(64, 'a')) == "0098ba824b5c16427bd7a1122a5a442a25ec644d");
+}
+
+BOOST_AUTO_TEST_CASE(MillionBytesInChunks)
+{
+  PRECICE_TEST(1_rank);
+  const std::string chunk(1000, 'a');
+  SHA1              sha1;
+  for (int i = 0; i < 1000; ++i) {
+    sha1.processBytes(chunk.data(), chunk.size());
+  }
+  BOOST_TEST(sha1.hexDigest() == "34aa973cd4c4daa4f61eeb2bdbad27316534016f");
+}
+
+BOOST_AUTO_TEST_CASE(IndependentOfChunks)
+{
+  PRECICE_TEST(1_rank);
+  const std::string message = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+  SHA1              sha1;
+  for (char c : message) {
+    sha1.processBytes(&c, 1);
+  }
+  BOOST_TEST(sha1.hexDigest() == hash(message));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SHA1
+BOOST_AUTO_TEST_SUITE_END() // Utils
@@ -31,6 +31,32 @@ BOOST_AUTO_TEST_CASE(DistanceAccumulator)
   BOOST_TEST(acc.max() == 23);
 }
 
+BOOST_AUTO_TEST_CASE(DistanceAccumulatorMerge)
+{
+  PRECICE_TEST(1_rank);
+  pu::statistics::DistanceAccumulator all, first, second, empty;
+  for (double value : {1.0, 2.0, 6.0}) {
+    all(value);
+    first(value);
+  }
+  for (double value : {-3.0, 4.0}) {
+    all(value);
+    second(value);
+  }
+  first.merge(empty);
+  first.merge(second);
+  BOOST_TEST(first.count() == all.count());
+  BOOST_TEST(first.min() == -3.0);
+  BOOST_TEST(first.max() == 6.0);
+  BOOST_TEST(first.mean() == all.mean());
+  BOOST_TEST(first.variance() == all.variance());
+
+  empty.merge(second);
+  BOOST_TEST(empty.count() == 2);
+  BOOST_TEST(empty.min() == -3.0);
+  BOOST_TEST(empty.max() == 4.0);
+}
+
 BOOST_AUTO_TEST_CASE(DistanceAccumulatorOnEmptyMesh)
 {
   pu::statistics::DistanceAccumulator acc;
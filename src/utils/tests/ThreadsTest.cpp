@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "utils/Threads.hpp"
+
+using namespace precice;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_AUTO_TEST_SUITE(ThreadsTests)
+
+BOOST_AUTO_TEST_CASE(ParallelForCoversRange)
+{
+  PRECICE_TEST(1_rank);
+  for (int threads : {1, 3}) {
+    utils::ScopedThreadCount threadCount(threads);
+    BOOST_TEST(utils::getThreadCount() == threads);
+
+    std::vector<int>                                 visits(1000, 0);
+    std::vector<std::pair<std::size_t, std::size_t>> chunks;
+    std::mutex                                       mutex;
+    utils::parallelFor(visits.size(), 10, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        ++visits[i];
+      }
+      std::lock_guard<std::mutex> lock(mutex);
+      chunks.emplace_back(begin, end);
+    });
+    BOOST_TEST(chunks.size() == static_cast<std::size_t>(threads));
+    BOOST_TEST(std::all_of(visits.begin(), visits.end(), [](int v) { return v == 1; }));
+  }
+  BOOST_TEST(utils::getThreadCount() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelForSmallRange)
+{
+  PRECICE_TEST(1_rank);
+  utils::ScopedThreadCount threadCount(4);
+  int                      calls = 0;
+  utils::parallelFor(15, 10, [&](std::size_t begin, std::size_t end) {
+    ++calls;
+    BOOST_TEST(begin == 0);
+    BOOST_TEST(end == 15);
+  });
+  BOOST_TEST(calls == 1);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelForPropagatesExceptions)
+{
+  PRECICE_TEST(1_rank);
+  utils::ScopedThreadCount threadCount(4);
+  for (std::size_t throwingChunk : {0, 3}) {
+    std::vector<int> visits(100, 0);
+    BOOST_CHECK_THROW(utils::parallelFor(visits.size(), 1, [&](std::size_t begin, std::size_t end) {
+      if (begin == throwingChunk * 25) {
+        throw std::runtime_error("failure");
+      }
+      std::fill(visits.begin() + begin, visits.begin() + end, 1);
+    }),
+                      std::runtime_error);
+    // All other chunks ran to completion
+    BOOST_TEST(std::count(visits.begin(), visits.end(), 1) == 75);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(NestedParallelForRunsSerially)
+{
+  PRECICE_TEST(1_rank);
+  utils::ScopedThreadCount threadCount(4);
+  BOOST_TEST(not utils::isInParallelRegion());
+
+  std::vector<int>         inRegion(4, 0);
+  std::vector<int>         innerCalls(4, 0);
+  std::vector<std::size_t> innerSizes(4, 0);
+  utils::parallelFor(4, 1, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t outer = begin; outer < end; ++outer) {
+      inRegion[outer] = utils::isInParallelRegion();
+      utils::parallelFor(100, 1, [&](std::size_t innerBegin, std::size_t innerEnd) {
+        ++innerCalls[outer];
+        innerSizes[outer] += innerEnd - innerBegin;
+      });
+    }
+  });
+  BOOST_TEST(not utils::isInParallelRegion());
+
+  BOOST_TEST(inRegion == std::vector<int>(4, 1), boost::test_tools::per_element());
+  // Every nested loop ran as a single chunk on the thread of its outer chunk
+  BOOST_TEST(innerCalls == std::vector<int>(4, 1), boost::test_tools::per_element());
+  BOOST_TEST(innerSizes == std::vector<std::size_t>(4, 100), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Threads
+BOOST_AUTO_TEST_SUITE_END() // Utils